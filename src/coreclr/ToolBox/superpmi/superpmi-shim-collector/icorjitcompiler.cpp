@@ -17,6 +17,18 @@ CorJitResult interceptor_ICJC::compileMethod(ICorJitInfo*                comp,
                                              uint32_t* nativeSizeOfCode            /* OUT */
                                              )
 {
+    // When sampling is enabled only every g_sampleRate-th compilation is recorded;
+    // the rest go straight to the real JIT without any shim bookkeeping.
+    if (g_sampleRate > 1)
+    {
+        static LONG s_compilationCount = -1;
+        LONG        count              = InterlockedIncrement(&s_compilationCount);
+        if ((count % (LONG)g_sampleRate) != 0)
+        {
+            return original_ICorJitCompiler->compileMethod(comp, info, flags, nativeEntry, nativeSizeOfCode);
+        }
+    }
+
     interceptor_ICJI our_ICorJitInfo;
     our_ICorJitInfo.original_ICorJitInfo = comp;
 
@@ -25,6 +25,7 @@ char*          g_logFilePath        = nullptr; // We *don't* leak this, hooray!
 WCHAR*         g_HomeDirectory      = nullptr;
 WCHAR*         g_DefaultRealJitPath = nullptr;
 MethodContext* g_globalContext      = nullptr;
+DWORD          g_sampleRate         = 1;       // 1 == collect every compilation
 bool           g_initialized        = false;
 
 void SetDefaultPaths()
@@ -70,6 +71,24 @@ void SetLogPathName()
     g_dataFileName = GetResultFileName(g_logPath, fileName, extension);
 }
 
+// A sample rate of N records roughly one out of every N compilations; the rest are
+// passed straight through to the real JIT with no shim overhead. This bounds the
+// size of the collection (and the collection cost) when the shim is left attached
+// to a long-running process. Unset, 0 or 1 collects everything, as before.
+void SetSampleRate()
+{
+    char* sampleRateStr = GetEnvironmentVariableWithDefaultA("SuperPMIShimSampleRate", nullptr);
+    if (sampleRateStr != nullptr)
+    {
+        DWORD sampleRate = (DWORD)strtoul(sampleRateStr, nullptr, 10);
+        if (sampleRate > 1)
+        {
+            g_sampleRate = sampleRate;
+        }
+        delete[] sampleRateStr;
+    }
+}
+
 // TODO: this only works for ANSI file paths...
 void SetLogFilePath()
 {
@@ -169,6 +188,7 @@ extern "C" DLLEXPORT ICorJitCompiler* getJit()
     SetLogPath();
     SetLogPathName();
     SetDebugDumpVariables();
+    SetSampleRate();
 
     if (!LoadRealJitLib(g_hRealJit, g_realJitPath))
     {
@@ -9,6 +9,7 @@
 
 class MethodContext;
 extern MethodContext* g_globalContext;
+extern DWORD          g_sampleRate;
 
 void DebugBreakorAV(int val);
 
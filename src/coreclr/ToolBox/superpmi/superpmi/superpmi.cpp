@@ -124,6 +124,61 @@ void InvokeNearDiffer(NearDiffer*           nearDiffer,
     PAL_ENDTRY
 }
 
+// Throughput summary support. When throughput collection is enabled (method stats type 't'),
+// per-method compile cycle counts are additionally accumulated into buckets keyed on the IL
+// size of the root method, so jit-throughput regressions can be localized to a corpus slice
+// (e.g., "only large methods got slower") without post-processing the .stats file.
+struct ThroughputBucket
+{
+    unsigned  maxILSize;   // inclusive upper bound on IL size for this bucket
+    int       methodCount;
+    ULONGLONG totalCycles;  // accumulated cycles for the (first) JIT
+    ULONGLONG totalCycles2; // accumulated cycles for the second JIT, if any
+};
+
+static ThroughputBucket s_tpBuckets[] = {
+    {16, 0, 0, 0}, {64, 0, 0, 0}, {256, 0, 0, 0}, {1024, 0, 0, 0}, {UINT_MAX, 0, 0, 0},
+};
+
+static void AddThroughputSample(unsigned ilSize, ULONGLONG cycles, ULONGLONG cycles2)
+{
+    for (size_t i = 0; i < _countof(s_tpBuckets); i++)
+    {
+        if (ilSize <= s_tpBuckets[i].maxILSize)
+        {
+            s_tpBuckets[i].methodCount++;
+            s_tpBuckets[i].totalCycles += cycles;
+            s_tpBuckets[i].totalCycles2 += cycles2;
+            break;
+        }
+    }
+}
+
+static void LogThroughputSummary(bool hasJit2)
+{
+    LogInfo("Throughput summary (cycles to compile, by IL size):");
+    unsigned minILSize = 0;
+    for (size_t i = 0; i < _countof(s_tpBuckets); i++)
+    {
+        const ThroughputBucket& bucket = s_tpBuckets[i];
+        if (bucket.methodCount != 0)
+        {
+            if (hasJit2)
+            {
+                LogInfo("  IL %u-%u: %d methods, total %llu / %llu, average %llu / %llu", minILSize,
+                        bucket.maxILSize, bucket.methodCount, bucket.totalCycles, bucket.totalCycles2,
+                        bucket.totalCycles / bucket.methodCount, bucket.totalCycles2 / bucket.methodCount);
+            }
+            else
+            {
+                LogInfo("  IL %u-%u: %d methods, total %llu, average %llu", minILSize, bucket.maxILSize,
+                        bucket.methodCount, bucket.totalCycles, bucket.totalCycles / bucket.methodCount);
+            }
+        }
+        minILSize = bucket.maxILSize + 1;
+    }
+}
+
 // Run superpmi. The return value is as follows:
 // 0    : success
 // -1   : general fatal error (e.g., failed to initialize, failed to read files)
@@ -480,6 +535,8 @@ int __cdecl main(int argc, char* argv[])
                         }
                     }
 
+                    AddThroughputSample(mc->methodSize, crl->clockCyclesToCompile, mc->cr->clockCyclesToCompile);
+
                     if (methodStatsEmitter != nullptr)
                     {
                         methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, crl->clockCyclesToCompile,
@@ -492,6 +549,7 @@ int __cdecl main(int argc, char* argv[])
                         mc->cr->clockCyclesToCompile = jit->times[1];
                     else
                         mc->cr->clockCyclesToCompile = jit->times[0];
+                    AddThroughputSample(mc->methodSize, mc->cr->clockCyclesToCompile, 0);
                     if (methodStatsEmitter != nullptr)
                     {
                         methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, mc->cr->clockCyclesToCompile, 0);
@@ -598,6 +656,11 @@ int __cdecl main(int argc, char* argv[])
         LogInfo(g_SummaryFormatString, loadedCount, jittedCount, failToReplayCount, excludedCount, missingCount);
     }
 
+    if (collectThroughput)
+    {
+        LogThroughputSummary(o.nameOfJit2 != nullptr);
+    }
+
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
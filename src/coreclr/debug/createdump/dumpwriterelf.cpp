@@ -2,6 +2,8 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "createdump.h"
+#include <new>
+#include <pthread.h>
 
 // Write the core dump file:
 //   ELF header
@@ -174,44 +176,186 @@ DumpWriter::WriteDump()
 
     // Read from target process and write memory regions to core
     uint64_t total = 0;
+    if (!WriteMemoryRegions(&total)) {
+        return false;
+    }
+
+    printf("Written %" PRId64 " bytes (%" PRId64 " pages) to core file\n", total, total / PAGE_SIZE);
+
+    return true;
+}
+
+// State shared between the reading (main) thread and the writer thread. Exactly one
+// buffer is in flight at a time: the main thread fills one staging buffer from the
+// target process while the writer thread flushes the other to the core file, so the
+// copy takes roughly max(read, write) time instead of their sum. With only two
+// threads the two wait conditions are mutually exclusive, so a single condition
+// variable with pthread_cond_signal is sufficient.
+struct WritePipeline
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int fd;
+    const BYTE* data;       // buffer handed to the writer, nullptr when the writer is idle
+    size_t size;
+    bool done;              // no more buffers coming
+    bool failed;            // the writer hit an I/O error
+};
+
+static void*
+WriterThread(void* arg)
+{
+    WritePipeline* pipeline = (WritePipeline*)arg;
+
+    pthread_mutex_lock(&pipeline->lock);
+    while (true)
+    {
+        while (pipeline->data == nullptr && !pipeline->done) {
+            pthread_cond_wait(&pipeline->cond, &pipeline->lock);
+        }
+        if (pipeline->data == nullptr) {
+            break;
+        }
+        if (pipeline->failed)
+        {
+            // Keep draining handed-off buffers after a failure so the reader never blocks
+            pipeline->data = nullptr;
+            pthread_cond_signal(&pipeline->cond);
+            continue;
+        }
+        const BYTE* data = pipeline->data;
+        size_t size = pipeline->size;
+        pthread_mutex_unlock(&pipeline->lock);
+
+        bool success = DumpWriter::WriteData(pipeline->fd, data, size);
+
+        pthread_mutex_lock(&pipeline->lock);
+        pipeline->data = nullptr;
+        if (!success) {
+            pipeline->failed = true;
+        }
+        pthread_cond_signal(&pipeline->cond);
+    }
+    pthread_mutex_unlock(&pipeline->lock);
+    return nullptr;
+}
+
+bool
+DumpWriter::WriteMemoryRegions(uint64_t* pTotal)
+{
+    // The 16k m_tempBuffer is far too small for multi-gigabyte heaps; it turns the
+    // copy into millions of read/write syscall pairs. Stage through megabyte buffers
+    // and overlap target reads with file writes on a helper thread.
+    const size_t BUFFER_SIZE = 1024 * 1024;
+    ArrayHolder<BYTE> buffer0 = new (std::nothrow) BYTE[BUFFER_SIZE];
+    ArrayHolder<BYTE> buffer1 = new (std::nothrow) BYTE[BUFFER_SIZE];
+    if (buffer0 == nullptr || buffer1 == nullptr) {
+        fprintf(stderr, "Could not allocate staging buffers\n");
+        return false;
+    }
+    BYTE* buffers[2] = { buffer0.GetPtr(), buffer1.GetPtr() };
+
+    WritePipeline pipeline;
+    pthread_mutex_init(&pipeline.lock, nullptr);
+    pthread_cond_init(&pipeline.cond, nullptr);
+    pipeline.fd = m_fd;
+    pipeline.data = nullptr;
+    pipeline.size = 0;
+    pipeline.done = false;
+    pipeline.failed = false;
+
+    // If the writer thread can't be created, fall back to writing inline
+    pthread_t thread;
+    bool pipelined = pthread_create(&thread, nullptr, WriterThread, &pipeline) == 0;
+
+    int current = 0;
+    bool success = true;
+    uint64_t total = 0;
+
     for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
     {
         // Only write the regions that are backed by memory
-        if (memoryRegion.IsBackedByMemory())
+        if (!memoryRegion.IsBackedByMemory()) {
+            continue;
+        }
+        uint64_t address = memoryRegion.StartAddress();
+        size_t size = memoryRegion.Size();
+        total += size;
+
+        while (size > 0)
         {
-            uint64_t address = memoryRegion.StartAddress();
-            size_t size = memoryRegion.Size();
-            total += size;
+            size_t bytesToRead = std::min(size, BUFFER_SIZE);
+            size_t read = 0;
 
-            while (size > 0)
-            {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
-                size_t read = 0;
+            if (!m_crashInfo.ReadProcessMemory((void*)address, buffers[current], bytesToRead, &read)) {
+                fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) FAILED\n", address, bytesToRead);
+                success = false;
+                break;
+            }
 
-                if (!m_crashInfo.ReadProcessMemory((void*)address, m_tempBuffer, bytesToRead, &read)) {
-                    fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) FAILED\n", address, bytesToRead);
-                    return false;
-                }
+            // This can happen if the target process dies before createdump is finished
+            if (read == 0) {
+                fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) returned 0 bytes read\n", address, bytesToRead);
+                success = false;
+                break;
+            }
 
-                // This can happen if the target process dies before createdump is finished
-                if (read == 0) {
-                    fprintf(stderr, "ReadProcessMemory(%" PRIA PRIx64 ", %08zx) returned 0 bytes read\n", address, bytesToRead);
-                    return false;
+            if (pipelined)
+            {
+                // Hand the filled buffer to the writer once it is idle and flip to the other one
+                pthread_mutex_lock(&pipeline.lock);
+                while (pipeline.data != nullptr && !pipeline.failed) {
+                    pthread_cond_wait(&pipeline.cond, &pipeline.lock);
                 }
-
-                if (!WriteData(m_tempBuffer, read)) {
-                    return false;
+                if (pipeline.failed) {
+                    pthread_mutex_unlock(&pipeline.lock);
+                    success = false;
+                    break;
                 }
+                pipeline.data = buffers[current];
+                pipeline.size = read;
+                pthread_cond_signal(&pipeline.cond);
+                pthread_mutex_unlock(&pipeline.lock);
 
-                address += read;
-                size -= read;
+                current = 1 - current;
             }
+            else if (!WriteData(buffers[current], read))
+            {
+                success = false;
+                break;
+            }
+
+            address += read;
+            size -= read;
+        }
+
+        if (!success) {
+            break;
         }
     }
 
-    printf("Written %" PRId64 " bytes (%" PRId64 " pages) to core file\n", total, total / PAGE_SIZE);
+    if (pipelined)
+    {
+        // Wait for the last buffer to land, then shut the writer down
+        pthread_mutex_lock(&pipeline.lock);
+        while (pipeline.data != nullptr && !pipeline.failed) {
+            pthread_cond_wait(&pipeline.cond, &pipeline.lock);
+        }
+        pipeline.done = true;
+        pthread_cond_signal(&pipeline.cond);
+        pthread_mutex_unlock(&pipeline.lock);
+        pthread_join(thread, nullptr);
 
-    return true;
+        if (pipeline.failed) {
+            success = false;
+        }
+    }
+
+    pthread_mutex_destroy(&pipeline.lock);
+    pthread_cond_destroy(&pipeline.cond);
+
+    *pTotal = total;
+    return success;
 }
 
 bool
@@ -53,6 +53,7 @@ private:
     size_t GetNTFileInfoSize(size_t* alignmentBytes = nullptr);
     bool WriteNTFileInfo();
     bool WriteThread(const ThreadInfo& thread, int fatal_signal);
+    bool WriteMemoryRegions(uint64_t* pTotal);
     bool WriteData(const void* buffer, size_t length) { return WriteData(m_fd, buffer, length); }
 
     size_t GetProcessInfoSize() const { return sizeof(Nhdr) + 8 + sizeof(prpsinfo_t); }
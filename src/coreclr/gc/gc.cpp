@@ -18,7 +18,7 @@
 
 #include "gcpriv.h"
 
-#if defined(TARGET_AMD64) && defined(TARGET_WINDOWS)
+#if (defined(TARGET_AMD64) && defined(TARGET_WINDOWS)) || defined(TARGET_ARM64)
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -1890,7 +1890,9 @@ size_t align_on_segment_hard_limit (size_t add)
 
 #endif //SERVER_GC
 
-const size_t etw_allocation_tick = 100*1024;
+// Amount of allocation that triggers the GCAllocationTick event; may be
+// overridden via the GCAllocationTickKB config during initialization.
+static size_t etw_allocation_tick = 100*1024;
 
 const size_t low_latency_alloc = 256*1024;
 
@@ -2145,6 +2147,7 @@ VOLATILE(BOOL) gc_heap::gc_started;
 #ifdef MULTIPLE_HEAPS
 GCEvent     gc_heap::gc_start_event;
 bool        gc_heap::gc_thread_no_affinitize_p = false;
+int         gc_heap::numa_remote_balance_factor = 2;
 uintptr_t   process_mask = 0;
 
 int         gc_heap::n_heaps;
@@ -2249,6 +2252,10 @@ size_t      gc_heap::heap_hard_limit = 0;
 
 size_t      gc_heap::heap_hard_limit_oh[total_oh_count - 1] = {0, 0, 0};
 
+size_t      gc_heap::heap_soft_limit = 0;
+
+size_t      gc_heap::pause_budget_us = 0;
+
 #ifdef USE_REGIONS
 size_t      gc_heap::regions_range = 0;
 #endif //USE_REGIONS
@@ -2460,6 +2467,8 @@ size_t      gc_heap::mark_stack_array_length = 0;
 
 mark*       gc_heap::mark_stack_array = 0;
 
+mark_queue_t gc_heap::mark_queue;
+
 #if defined (_DEBUG) && defined (VERIFY_HEAP)
 BOOL        gc_heap::verify_pinned_queue_p = FALSE;
 #endif //_DEBUG && VERIFY_HEAP
@@ -2634,6 +2643,7 @@ uint64_t gc_heap::total_loh_a_last_bgc = 0;
 size_t gc_heap::eph_gen_starts_size = 0;
 heap_segment* gc_heap::segment_standby_list;
 bool          gc_heap::use_large_pages_p = 0;
+bool          gc_heap::card_table_use_large_pages_p = 0;
 #ifdef HEAP_BALANCE_INSTRUMENTATION
 size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
@@ -6682,9 +6692,10 @@ bool gc_heap::virtual_commit (void* address, size_t size, gc_oh_num oh, int h_nu
 {
 #ifndef HOST_64BIT
     assert (heap_hard_limit == 0);
+    assert (heap_soft_limit == 0);
 #endif //!HOST_64BIT
 
-    if (heap_hard_limit)
+    if (heap_hard_limit || heap_soft_limit)
     {
         check_commit_cs.Enter();
         bool exceeded_p = false;
@@ -6696,7 +6707,7 @@ bool gc_heap::virtual_commit (void* address, size_t size, gc_oh_num oh, int h_nu
                 exceeded_p = true;
             }
         }
-        else if ((current_total_committed + size) > heap_hard_limit)
+        else if (heap_hard_limit && ((current_total_committed + size) > heap_hard_limit))
         {
             dprintf (1, ("%Id + %Id = %Id > limit %Id ",
                 current_total_committed, size,
@@ -6732,7 +6743,7 @@ bool gc_heap::virtual_commit (void* address, size_t size, gc_oh_num oh, int h_nu
                               virtual_alloc_commit_for_heap (address, size, h_number)) :
                               GCToOSInterface::VirtualCommit(address, size));
 
-    if (!commit_succeeded_p && heap_hard_limit)
+    if (!commit_succeeded_p && (heap_hard_limit || heap_soft_limit))
     {
         check_commit_cs.Enter();
         committed_by_oh[oh] -= size;
@@ -6752,11 +6763,12 @@ bool gc_heap::virtual_decommit (void* address, size_t size, gc_oh_num oh, int h_
 {
 #ifndef HOST_64BIT
     assert (heap_hard_limit == 0);
+    assert (heap_soft_limit == 0);
 #endif //!HOST_64BIT
 
     bool decommit_succeeded_p = GCToOSInterface::VirtualDecommit (address, size);
 
-    if (decommit_succeeded_p && heap_hard_limit)
+    if (decommit_succeeded_p && (heap_hard_limit || heap_soft_limit))
     {
         check_commit_cs.Enter();
         committed_by_oh[oh] -= size;
@@ -8440,22 +8452,45 @@ uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
     // it is impossible for alloc_size to overflow due bounds on each of
     // its components.
     size_t alloc_size = sizeof (uint8_t)*(sizeof(card_table_info) + cs + bs + cb + wws + st + ms);
-    uint8_t* mem = (uint8_t*)GCToOSInterface::VirtualReserve (alloc_size, 0, virtual_reserve_flags);
 
-    if (!mem)
-        return 0;
+    // If the heap itself is backed by large pages, do the same for the bookkeeping
+    // tables - every write barrier touches the card table, so on big reservations
+    // its TLB footprint is significant. OS write watch cannot be combined with
+    // large pages, so only do this if no write watch is needed over this region.
+    card_table_use_large_pages_p = use_large_pages_p && (virtual_reserve_flags == VirtualReserveFlags::None);
 
-    dprintf (2, ("Init - Card table alloc for %Id bytes: [%Ix, %Ix[",
-                 alloc_size, (size_t)mem, (size_t)(mem+alloc_size)));
+    uint8_t* mem;
 
-    // mark array will be committed separately (per segment).
-    size_t commit_size = alloc_size - ms;
+    if (card_table_use_large_pages_p)
+    {
+        // This commits everything, including the mark array - there is no
+        // per-segment commit out of a large pages mapping.
+        mem = (uint8_t*)GCToOSInterface::VirtualReserveAndCommitLargePages (alloc_size);
+        if (!mem)
+            return 0;
 
-    if (!virtual_commit (mem, commit_size, gc_oh_num::none))
+        dprintf (2, ("Init - Card table alloc (large pages) for %Id bytes: [%Ix, %Ix[",
+                     alloc_size, (size_t)mem, (size_t)(mem+alloc_size)));
+    }
+    else
     {
-        dprintf (1, ("Card table commit failed"));
-        GCToOSInterface::VirtualRelease (mem, alloc_size);
-        return 0;
+        mem = (uint8_t*)GCToOSInterface::VirtualReserve (alloc_size, 0, virtual_reserve_flags);
+
+        if (!mem)
+            return 0;
+
+        dprintf (2, ("Init - Card table alloc for %Id bytes: [%Ix, %Ix[",
+                     alloc_size, (size_t)mem, (size_t)(mem+alloc_size)));
+
+        // mark array will be committed separately (per segment).
+        size_t commit_size = alloc_size - ms;
+
+        if (!virtual_commit (mem, commit_size, gc_oh_num::none))
+        {
+            dprintf (1, ("Card table commit failed"));
+            GCToOSInterface::VirtualRelease (mem, alloc_size);
+            return 0;
+        }
     }
 
     // initialize the ref count
@@ -8536,6 +8571,11 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
     // See if the address is already covered
     if ((la != saved_g_lowest_address ) || (ha != saved_g_highest_address))
     {
+        // With large pages the whole range was reserved up front and segments
+        // never come from outside of it, so the tables should never grow - and
+        // a grown table would no longer be large pages backed.
+        assert (!card_table_use_large_pages_p);
+
         {
             //modify the highest address so the span covered
             //is twice the previous one.
@@ -9380,6 +9420,37 @@ private:
 #endif //defined(USE_INTROSORT) || defined(USE_VXSORT)
 
 #ifdef USE_VXSORT
+#ifdef TARGET_ARM64
+static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
+{
+    // below this size the scalar leaf handling in introsort does just as well
+    const ptrdiff_t NEON_THRESHOLD_SIZE = 1024;
+
+    if (item_count <= 1)
+        return;
+
+    if (item_count > NEON_THRESHOLD_SIZE)
+    {
+        dprintf (3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+    else
+    {
+        dprintf (3, ("Sorting mark lists"));
+        introsort::sort (item_array, &item_array[item_count - 1], 0);
+    }
+#ifdef _DEBUG
+    // check the array is sorted
+    for (ptrdiff_t i = 0; i < item_count - 1; i++)
+    {
+        assert (item_array[i] <= item_array[i + 1]);
+    }
+    // check that the ends of the array are indeed in range
+    // together with the above this implies all elements are in range
+    assert ((range_low <= item_array[0]) && (item_array[item_count - 1] <= range_high));
+#endif
+}
+#else //TARGET_ARM64
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
     // above this threshold, using AVX2 for sorting will likely pay off
@@ -9423,6 +9494,7 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
     assert ((range_low <= item_array[0]) && (item_array[item_count - 1] <= range_high));
 #endif
 }
+#endif //TARGET_ARM64
 #endif //USE_VXSORT
 
 #ifdef MULTIPLE_HEAPS
@@ -10026,13 +10098,22 @@ void gc_heap::grow_mark_list ()
 {
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
+#ifdef TARGET_ARM64
+    // NEON is always available
+#ifdef MULTIPLE_HEAPS
+    const size_t MAX_MARK_LIST_SIZE = 1000 * 1024;
+#else //MULTIPLE_HEAPS
+    const size_t MAX_MARK_LIST_SIZE = 32 * 1024;
+#endif //MULTIPLE_HEAPS
+#else //TARGET_ARM64
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ? 
+    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ? 
+    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
+#endif //TARGET_ARM64
 #else //USE_VXSORT
 #ifdef MULTIPLE_HEAPS
     const size_t MAX_MARK_LIST_SIZE = 200 * 1024;
@@ -10798,14 +10879,15 @@ void gc_heap::clear_region_info (heap_segment* region)
 #endif //BACKGROUND_GC
 }
 
-// Note that returning a region to free does not decommit. 
-// REGIONS PERF TODO: should decommit if needed.
 void gc_heap::return_free_region (heap_segment* region)
 {
     clear_region_info (region);
 
+    int num_existing_free_regions = 0;
+
     if (heap_segment_uoh_p (region))
     {
+        num_existing_free_regions = num_free_large_regions;
         num_free_large_regions++;
         num_free_large_regions_added++;
         heap_segment_next (region) = free_large_regions;
@@ -10813,12 +10895,22 @@ void gc_heap::return_free_region (heap_segment* region)
     }
     else
     {
+        num_existing_free_regions = num_free_regions;
         num_free_regions++;
         num_free_regions_added++;
         heap_segment_next (region) = free_regions;
         free_regions = region;
     }
 
+    // Retain the commit on only a limited number of free regions so they can be handed
+    // out again cheaply; decommit the rest so idle regions don't hold on to physical
+    // memory after the heap shrinks.
+    if (!use_large_pages_p &&
+        (num_existing_free_regions >= (int)GCConfig::GetGCRegionsFreeCommit()))
+    {
+        decommit_heap_segment (region);
+    }
+
     committed_in_free += heap_segment_committed (region) - get_region_start (region);
 
     uint8_t* region_start = get_region_start (region);
@@ -11972,6 +12064,15 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
     }
 #endif //GC_CONFIG_DRIVEN
 
+    // Allow the allocation sampling rate for GCAllocationTick to be tuned;
+    // continuous profilers may want finer (or coarser) samples than the
+    // default 100KB.
+    size_t allocation_tick_kb = static_cast<size_t>(GCConfig::GetGCAllocationTickKB());
+    if (allocation_tick_kb != 0)
+    {
+        etw_allocation_tick = allocation_tick_kb * 1024;
+    }
+
     HRESULT hres = S_OK;
 
 #ifdef WRITE_WATCH
@@ -12014,7 +12115,7 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
     int number_of_heaps = 1;
 #endif //MULTIPLE_HEAPS
 
-    if (heap_hard_limit)
+    if (heap_hard_limit || heap_soft_limit)
     {
         check_commit_cs.Initialize();
     }
@@ -12146,7 +12247,8 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
                                          static_cast<int>(GCEventStatus::GetEnabledKeywords(GCEventProvider_Private)));
 #endif // __linux__
 
-#ifdef USE_VXSORT
+#if defined(USE_VXSORT) && !defined(TARGET_ARM64)
+    // NEON is baseline on ARM64, so no instruction set detection is needed there.
     InitSupportedInstructionSet ((int32_t)GCConfig::GetGCEnabledInstructionSets());
 #endif
 
@@ -16523,8 +16625,14 @@ void gc_heap::balance_heaps (alloc_context* acontext)
 
                         if ((max_hp == org_hp) && (end < finish))
                         {
+                            if (numa_remote_balance_factor == 0)
+                            {
+                                // strict node-local mode - gen0 allocation never spills to a remote node
+                                break;
+                            }
                             start = end; end = finish;
-                            delta = local_delta * 2; // Make it twice as hard to balance to remote nodes on NUMA.
+                            // Make it correspondingly harder to balance to remote nodes on NUMA.
+                            delta = local_delta * numa_remote_balance_factor;
                         }
                         else
                         {
@@ -18866,6 +18974,16 @@ int gc_heap::generation_to_condemn (int n_initial,
         }
     }
 
+    // Being above the soft limit is treated like high physical memory load -
+    // we want to elevate so the full GC can compact and decommit us back
+    // under the limit.
+    if (heap_soft_limit && (current_total_committed >= heap_soft_limit))
+    {
+        dprintf (GTC_LOG, ("h%d: committed %Id is over soft limit %Id",
+            heap_number, current_total_committed, heap_soft_limit));
+        high_memory_load = TRUE;
+    }
+
     dprintf (GTC_LOG, ("h%d: le: %d, hm: %d, vm: %d, f: %d",
                  heap_number, low_ephemeral_space, high_memory_load, v_high_memory_load,
                  high_fragmentation));
@@ -21338,6 +21456,121 @@ BOOL gc_heap::gc_mark (uint8_t* o, uint8_t* low, uint8_t* high, int condemned_ge
 #endif //USE_REGIONS
 }
 
+mark_queue_t::mark_queue_t() : curr_slot_index(0)
+{
+#ifdef MARK_PHASE_PREFETCH
+    for (size_t i = 0; i < slot_count; i++)
+    {
+        slot_table[i] = nullptr;
+    }
+#endif //MARK_PHASE_PREFETCH
+}
+
+// place an object in the mark queue. returns an earlier queued object whose
+// prefetch has had time to complete and that turned out to be newly marked,
+// or nullptr. the caller is responsible for the range/condemned gen filtering
+// that gc_mark does - only the mark bit test itself is deferred here.
+FORCEINLINE
+uint8_t* mark_queue_t::queue_mark (uint8_t* o)
+{
+#ifdef MARK_PHASE_PREFETCH
+    Prefetch (o);
+
+    // while the prefetch is taking effect, park our object in the queue
+    // and retrieve another object that has been prefetched earlier
+    size_t slot_index = curr_slot_index;
+    uint8_t* old_o = slot_table[slot_index];
+    slot_table[slot_index] = o;
+    curr_slot_index = (slot_index + 1) % slot_count;
+    if (old_o == nullptr)
+        return nullptr;
+#else //MARK_PHASE_PREFETCH
+    uint8_t* old_o = o;
+#endif //MARK_PHASE_PREFETCH
+
+    // this touches the object header and is what the prefetch was for
+    if (marked (old_o))
+    {
+        return nullptr;
+    }
+    set_marked (old_o);
+    return old_o;
+}
+
+// returns the next object in the queue that still needs to be marked, setting
+// its mark bits, or nullptr once the queue is empty.
+uint8_t* mark_queue_t::get_next_marked()
+{
+#ifdef MARK_PHASE_PREFETCH
+    size_t slot_index = curr_slot_index;
+    for (size_t i = 0; i < slot_count; i++)
+    {
+        uint8_t* o = slot_table[slot_index];
+        slot_table[slot_index] = nullptr;
+        slot_index = (slot_index + 1) % slot_count;
+        if (o != nullptr)
+        {
+            curr_slot_index = slot_index;
+            if (!marked (o))
+            {
+                set_marked (o);
+                return o;
+            }
+        }
+    }
+#endif //MARK_PHASE_PREFETCH
+    return nullptr;
+}
+
+void mark_queue_t::verify_empty()
+{
+#ifdef MARK_PHASE_PREFETCH
+    for (size_t i = 0; i < slot_count; i++)
+    {
+        assert (slot_table[i] == nullptr);
+    }
+#endif //MARK_PHASE_PREFETCH
+}
+
+// the queued counterpart of gc_mark - performs the same filtering, then runs the
+// reference through the mark prefetch queue. the object returned (if any) is an
+// earlier reference that was newly marked, not necessarily o itself.
+FORCEINLINE
+uint8_t* gc_heap::mark_object_queued (uint8_t* o, uint8_t* low, uint8_t* high, int condemned_gen)
+{
+#ifdef USE_REGIONS
+    assert (low == 0);
+    assert (high == 0);
+    if (o != nullptr)
+    {
+        if ((condemned_gen == max_generation) || (get_region_gen_num (o) <= condemned_gen))
+        {
+            return mark_queue.queue_mark (o);
+        }
+    }
+    return nullptr;
+#else //USE_REGIONS
+    assert (condemned_gen == -1);
+
+    if ((o >= low) && (o < high))
+    {
+        return mark_queue.queue_mark (o);
+    }
+#ifdef MULTIPLE_HEAPS
+    else if (o)
+    {
+        gc_heap* hp = heap_of_gc (o);
+        assert (hp);
+        if ((o >= hp->gc_low) && (o < hp->gc_high))
+        {
+            return mark_queue.queue_mark (o);
+        }
+    }
+#endif //MULTIPLE_HEAPS
+    return nullptr;
+#endif //USE_REGIONS
+}
+
 #ifdef BACKGROUND_GC
 
 inline
@@ -21748,9 +21981,8 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
 
                     go_through_object_cl (method_table(oo), oo, s, ppslot,
                                           {
-                                              uint8_t* o = *ppslot;
-                                              Prefetch(o);
-                                              if (gc_mark (o, gc_low, gc_high, condemned_gen))
+                                              uint8_t* o = mark_object_queued (*ppslot, gc_low, gc_high, condemned_gen);
+                                              if (o != nullptr)
                                               {
                                                   if (full_p)
                                                   {
@@ -21846,9 +22078,8 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                     go_through_object (method_table(oo), oo, s, ppslot,
                                        start, use_start, (oo + s),
                                        {
-                                           uint8_t* o = *ppslot;
-                                           Prefetch(o);
-                                           if (gc_mark (o, gc_low, gc_high,condemned_gen))
+                                           uint8_t* o = mark_object_queued (*ppslot, gc_low, gc_high, condemned_gen);
+                                           if (o != nullptr)
                                            {
                                                 if (full_p)
                                                 {
@@ -21925,6 +22156,40 @@ more_to_do:
     }
 }
 
+// empties the mark prefetch queue, finishing the marking work that queue_mark
+// deferred. this must run before anything inspects the mark bits - in particular
+// before dependent handle scanning and the weak pointer scans.
+void gc_heap::drain_mark_queue ()
+{
+#ifdef MARK_PHASE_PREFETCH
+#ifdef MULTIPLE_HEAPS
+    const int thread = heap_number;
+#else //MULTIPLE_HEAPS
+    const int thread = 0;
+#endif //MULTIPLE_HEAPS
+
+    BOOL full_p = (settings.condemned_generation == max_generation);
+
+    uint8_t* o;
+    while ((o = mark_queue.get_next_marked()) != nullptr)
+    {
+        if (full_p)
+        {
+            m_boundary_fullgc (o);
+        }
+        else
+        {
+            m_boundary (o);
+        }
+        add_to_promoted_bytes (o, thread);
+        if (contain_pointers_or_collectible (o))
+        {
+            mark_object_simple1 (o, o THREAD_NUMBER_ARG);
+        }
+    }
+#endif //MARK_PHASE_PREFETCH
+}
+
 #ifdef MH_SC_MARK
 BOOL same_numa_node_p (int hn1, int hn2)
 {
@@ -23551,6 +23816,10 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
         if (process_mark_overflow(condemned_gen_number))
             fUnscannedPromotions = true;
 
+        // The scan below tests mark bits, so any marking the overflow processing deferred
+        // into the mark prefetch queue has to be completed first.
+        drain_mark_queue();
+
         // Perform the scan and set the flag if any promotions resulted.
         if (GCScan::GcDhReScan(sc))
             fUnscannedPromotions = true;
@@ -23560,6 +23829,7 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
     // scan any handles at all this is the processing of overflows that may have occurred prior to this method
     // invocation).
     process_mark_overflow(condemned_gen_number);
+    drain_mark_queue();
 }
 #endif //MULTIPLE_HEAPS
 
@@ -23999,6 +24269,8 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     // to optimize away further scans. The call to scan_dependent_handles is what will cycle through more
     // iterations if required and will also perform processing of any mark stack overflow once the dependent
     // handle table has been fully promoted.
+    // Make sure all deferred marking is finished before anybody starts looking at mark bits.
+    drain_mark_queue();
     GCScan::GcDhInitialScan(GCHeap::Promote, condemned_gen_number, max_generation, &sc);
     scan_dependent_handles(condemned_gen_number, &sc, true);
 
@@ -24075,10 +24347,15 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     GCToEEInterface::DiagWalkFReachableObjects(__this);
 #endif // FEATURE_PREMORTEM_FINALIZATION
 
+    // Finish any marking deferred by the finalization scan before mark bits are examined again.
+    drain_mark_queue();
+
     // Scan dependent handles again to promote any secondaries associated with primaries that were promoted
     // for finalization. As before scan_dependent_handles will also process any mark stack overflow.
     scan_dependent_handles(condemned_gen_number, &sc, false);
 
+    mark_queue.verify_empty();
+
     total_promoted_bytes = get_promoted_bytes();
 
 #ifdef MULTIPLE_HEAPS
@@ -31214,6 +31491,14 @@ BOOL gc_heap::commit_mark_array_new_seg (gc_heap* hp,
 
 BOOL gc_heap::commit_mark_array_by_range (uint8_t* begin, uint8_t* end, uint32_t* mark_array_addr)
 {
+    // A large pages backed card table was committed in full, mark array included,
+    // when it was allocated.
+    if (card_table_use_large_pages_p)
+    {
+        verify_mark_array_cleared (begin, end, mark_array_addr);
+        return TRUE;
+    }
+
     size_t beg_word = mark_word_of (begin);
     size_t end_word = mark_word_of (align_on_mark_word (end));
     uint8_t* commit_start = align_lower_page ((uint8_t*)&mark_array_addr[beg_word]);
@@ -31457,7 +31742,11 @@ void gc_heap::decommit_mark_array_by_seg (heap_segment* seg)
 
         if (decommit_start < decommit_end)
         {
-            if (!virtual_decommit (decommit_start, size, gc_oh_num::none))
+            // Never decommit pieces of a large pages backed card table; the
+            // seg flags are still updated below so the bookkeeping on the
+            // segment stays consistent.
+            if (!card_table_use_large_pages_p &&
+                !virtual_decommit (decommit_start, size, gc_oh_num::none))
             {
                 dprintf (GC_TABLE_LOG, ("decommit on %Ix for %Id bytes failed",
                                         decommit_start, size));
@@ -34300,9 +34589,22 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         size_t end_cardb = cardw_card_bundle (align_cardw_on_bundle (cardw_end));
         while (1)
         {
-            // Find a non-zero bundle
-            while ((cardb < end_cardb) && (card_bundle_set_p (cardb) == 0))
+            // Find a non-zero bundle. When we are aligned on a word of the
+            // bundle table and it's all clear we skip the whole word - on huge
+            // mostly-clean heaps this covers 32 bundles with a single load.
+            while (cardb < end_cardb)
             {
+                if ((card_bundle_bit (cardb) == 0) &&
+                    ((cardb + card_bundle_word_width) <= end_cardb) &&
+                    (card_bundle_table[card_bundle_word (cardb)] == 0))
+                {
+                    cardb += card_bundle_word_width;
+                    continue;
+                }
+                if (card_bundle_set_p (cardb) != 0)
+                {
+                    break;
+                }
                 cardb++;
             }
             if (cardb == end_cardb)
@@ -34339,6 +34641,26 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
         uint32_t* card_word = &card_table[cardw];
         uint32_t* card_word_end = &card_table [cardw_end];
 
+        // Scan card words one at a time until the pointer is aligned, then
+        // consume a pointer-width of clean card words per load.
+        while ((card_word < card_word_end) &&
+               (((size_t)card_word & (sizeof(size_t) - 1)) != 0))
+        {
+            if ((*card_word) != 0)
+            {
+                cardw = (card_word - &card_table [0]);
+                return TRUE;
+            }
+
+            card_word++;
+        }
+
+        while (((card_word + (sizeof(size_t) / sizeof(uint32_t))) <= card_word_end) &&
+               ((*(size_t*)card_word) == 0))
+        {
+            card_word += sizeof(size_t) / sizeof(uint32_t);
+        }
+
         while (card_word < card_word_end)
         {
             if ((*card_word) != 0)
@@ -36869,6 +37191,24 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
             new_allocation = linear_allocation_model (allocation_fraction, new_allocation,
                                                       dd_desired_allocation (dd), dd_collection_count (dd));
 
+            if (pause_budget_us != 0)
+            {
+                // If the last collection condemning this generation blew the pause
+                // budget, shrink its budget proportionally - a smaller budget means
+                // we collect earlier with less live data to go through. When we are
+                // under budget the normal growth model above is left alone.
+                size_t last_pause = dd_gc_elapsed_time (dd);
+                if (last_pause > pause_budget_us)
+                {
+                    size_t new_allocation1 = max (min_gc_size,
+                                                  (size_t)((float)new_allocation *
+                                                           ((float)pause_budget_us / (float)last_pause)));
+                    dprintf (2, ("Reducing gen%d allocation for pause budget (%Id us > %Id us) from %Id to %Id",
+                                 gen_number, last_pause, pause_budget_us, new_allocation, new_allocation1));
+                    new_allocation = new_allocation1;
+                }
+            }
+
             if (gen_number == 0)
             {
                 if (pass == 0)
@@ -37303,6 +37643,13 @@ void gc_heap::decommit_ephemeral_segment_pages()
 #endif //FEATURE_CORECLR
 #endif // HOST_64BIT
 
+    if (heap_soft_limit && (current_total_committed >= heap_soft_limit))
+    {
+        // Over the soft limit we give up the extra slack - keep only what the
+        // next gen0 budget needs so the rest gets decommitted.
+        slack_space = min (slack_space, (size_t)max (desired_allocation, (ptrdiff_t)0));
+    }
+
     uint8_t *decommit_target = heap_segment_allocated (ephemeral_heap_segment) + slack_space;
     if (decommit_target < heap_segment_decommit_target (ephemeral_heap_segment))
     {
@@ -37690,6 +38037,14 @@ BOOL gc_heap::decide_on_compacting (int condemned_gen_number,
         should_compact = TRUE;
     }
 
+    if (heap_soft_limit && (current_total_committed >= heap_soft_limit))
+    {
+        dprintf (GTC_LOG, ("compacting because committed %Id is over soft limit %Id",
+            current_total_committed, heap_soft_limit));
+        should_compact = TRUE;
+        get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_high_mem_load);
+    }
+
 #ifdef USE_REGIONS
     if (!should_compact)
     {
@@ -38925,7 +39280,10 @@ void gc_heap::background_sweep()
     disable_preemptive (true);
 
     dynamic_data* dd     = dynamic_data_of (max_generation);
-    const int num_objs   = 256;
+    // How many objects we sweep before checking whether the EE wants to suspend us.
+    // This bounds the uninterruptible stretches of free list rebuilding that
+    // otherwise show up as allocation stalls in latency-sensitive processes.
+    const int num_objs   = max (1, (int)GCConfig::GetBGCSweepQuantum());
     int current_num_objs = 0;
 
     for (int i = max_generation; i < total_generation_count; i++)
@@ -41319,6 +41677,25 @@ HRESULT GCHeap::Initialize()
         return CLR_E_GC_LARGE_PAGE_MISSING_HARD_LIMIT;
     }
 
+    gc_heap::heap_soft_limit = (size_t)GCConfig::GetGCHeapSoftLimit();
+
+    if (!(gc_heap::heap_soft_limit))
+    {
+        uint32_t percent_of_mem = (uint32_t)GCConfig::GetGCHeapSoftLimitPercent();
+        if ((percent_of_mem > 0) && (percent_of_mem < 100))
+        {
+            gc_heap::heap_soft_limit = (size_t)(gc_heap::total_physical_mem * (uint64_t)percent_of_mem / (uint64_t)100);
+        }
+    }
+
+    // A soft limit at or above the hard limit would never do anything useful -
+    // the hard limit would always kick in first.
+    if (gc_heap::heap_soft_limit && gc_heap::heap_hard_limit &&
+        (gc_heap::heap_soft_limit >= gc_heap::heap_hard_limit))
+    {
+        return CLR_E_GC_BAD_HARD_LIMIT;
+    }
+
 #endif //HOST_64BIT
 
     uint32_t nhp = 1;
@@ -41365,9 +41742,13 @@ HRESULT GCHeap::Initialize()
 
     nhp = min (nhp, MAX_SUPPORTED_CPUS);
 
-    gc_heap::gc_thread_no_affinitize_p = (gc_heap::heap_hard_limit ? 
+    gc_heap::gc_thread_no_affinitize_p = (gc_heap::heap_hard_limit ?
         !affinity_config_specified_p : (GCConfig::GetNoAffinitize() != 0));
 
+    gc_heap::numa_remote_balance_factor = (int)GCConfig::GetGCNumaRemoteBalanceFactor();
+
+    gc_heap::pause_budget_us = (size_t)GCConfig::GetGCPauseBudgetMS() * 1000;
+
     if (!(gc_heap::gc_thread_no_affinitize_p))
     {
         uint32_t num_affinitized_processors = (uint32_t)process_affinity_set->Count();
@@ -42279,7 +42660,7 @@ GCHeap::Alloc(gc_alloc_context* context, size_t size, uint32_t flags REQD_ALIGN_
 
     if (flags & GC_ALLOC_USER_OLD_HEAP)
     {
-        // The LOH always guarantees at least 8-byte alignment, regardless of platform. Moreover it doesn't
+        // The UOH generations (LOH and POH) always guarantee at least 8-byte alignment, regardless of platform. Moreover they don't
         // support mis-aligned object headers so we can't support biased headers. Luckily for us
         // we've managed to arrange things so the only case where we see a bias is for boxed value types and
         // these can never get large enough to be allocated on the LOH.
@@ -43998,21 +44379,35 @@ Object* GCHeap::GetNextFinalizableObject()
 
 #ifdef MULTIPLE_HEAPS
 
+    // Only the finalizer thread drains the queues, so a simple cursor is
+    // enough to resume on the heap that last had work. Without it, draining a
+    // burst of finalizable objects rescanned (and locked) every empty queue
+    // before heap N for each object, which is quadratic in the heap count.
+    static int last_drained_heap = 0;
+
     //return the first non critical one in the first queue.
-    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    for (int idx = 0; idx < gc_heap::n_heaps; idx++)
     {
+        int hn = (last_drained_heap + idx) % gc_heap::n_heaps;
         gc_heap* hp = gc_heap::g_heaps [hn];
         Object* O = hp->finalize_queue->GetNextFinalizableObject(TRUE);
         if (O)
+        {
+            last_drained_heap = hn;
             return O;
+        }
     }
     //return the first non critical/critical one in the first queue.
-    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    for (int idx = 0; idx < gc_heap::n_heaps; idx++)
     {
+        int hn = (last_drained_heap + idx) % gc_heap::n_heaps;
         gc_heap* hp = gc_heap::g_heaps [hn];
         Object* O = hp->finalize_queue->GetNextFinalizableObject(FALSE);
         if (O)
+        {
+            last_drained_heap = hn;
             return O;
+        }
     }
     return 0;
 
@@ -44659,6 +45054,97 @@ void gc_heap::walk_heap (walk_fn fn, void* context, int gen_number, BOOL walk_la
 #endif //MULTIPLE_HEAPS
 }
 
+// Walk the range [x, end) invoking fn on every non-free object whose header passes
+// a plausibility check. Unlike walk_heap_per_heap this runs while mutators are
+// active, so each header is validated before it is trusted: the method table
+// pointer must look like a pointer to somewhere outside the GC heap and the
+// computed size must land inside the range. An object that fails the check (an
+// allocation whose header is not yet written, or torn state) ends the walk of this
+// range since the next object can no longer be located.
+// Returns FALSE if fn asked to stop the walk altogether.
+BOOL gc_heap::walk_diag_range_without_suspension (uint8_t* x, uint8_t* end, int align_const,
+                                                  walk_fn fn, void* context)
+{
+    while (x < end)
+    {
+        MethodTable* mt = method_table (x);
+        if ((mt == 0) || (((size_t)mt & (sizeof (size_t) - 1)) != 0) ||
+            (((uint8_t*)mt >= g_gc_lowest_address) && ((uint8_t*)mt < g_gc_highest_address)))
+        {
+            return TRUE;
+        }
+
+        size_t s = size (x);
+        if ((s < min_obj_size) || (s > (size_t)(end - x)))
+        {
+            return TRUE;
+        }
+
+        CObjectHeader* o = (CObjectHeader*)x;
+        if (!o->IsFree())
+        {
+            if (!fn (o->GetObjectBase(), context))
+                return FALSE;
+        }
+        x = x + Align (s, align_const);
+    }
+
+    return TRUE;
+}
+
+void gc_heap::walk_heap_without_suspension_per_heap (walk_fn fn, void* context)
+{
+    // Walk generation max_generation, skipping the ephemeral segment - the
+    // generation boundaries within it move underneath a running mutator.
+    heap_segment* seg = generation_start_segment (generation_of (max_generation));
+    int align_const = get_alignment_constant (TRUE);
+
+    while (seg)
+    {
+#ifndef USE_REGIONS
+        if (seg != ephemeral_heap_segment)
+#endif //!USE_REGIONS
+        {
+            if (!walk_diag_range_without_suspension (heap_segment_mem (seg), heap_segment_allocated (seg),
+                                                     align_const, fn, context))
+            {
+                return;
+            }
+        }
+        seg = heap_segment_next (seg);
+    }
+
+    align_const = get_alignment_constant (FALSE);
+
+    for (int i = uoh_start_generation; i < total_generation_count; i++)
+    {
+        seg = generation_start_segment (generation_of (i));
+        while (seg)
+        {
+            if (!walk_diag_range_without_suspension (heap_segment_mem (seg), heap_segment_allocated (seg),
+                                                     align_const, fn, context))
+            {
+                return;
+            }
+            seg = heap_segment_next (seg);
+        }
+    }
+}
+
+void gc_heap::walk_heap_without_suspension (walk_fn fn, void* context)
+{
+#ifdef MULTIPLE_HEAPS
+    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [hn];
+
+        hp->walk_heap_without_suspension_per_heap (fn, context);
+    }
+#else
+    walk_heap_without_suspension_per_heap (fn, context);
+#endif //MULTIPLE_HEAPS
+}
+
 void GCHeap::DiagWalkObject (Object* obj, walk_fn fn, void* context)
 {
     uint8_t* o = (uint8_t*)obj;
@@ -44713,6 +45199,11 @@ void GCHeap::DiagWalkHeap (walk_fn fn, void* context, int gen_number, bool walk_
     gc_heap::walk_heap (fn, context, gen_number, walk_large_object_heap_p);
 }
 
+void GCHeap::DiagWalkHeapWithoutSuspension (walk_fn fn, void* context)
+{
+    gc_heap::walk_heap_without_suspension (fn, context);
+}
+
 void GCHeap::DiagWalkFinalizeQueue (void* gc_context, fq_walk_fn fn)
 {
     gc_heap* hp = (gc_heap*)gc_context;
@@ -75,6 +75,8 @@ public:
     BOOL_CONFIG  (LogEnabled,             "GCLogEnabled",           NULL,                             false,             "Specifies if you want to turn on logging in GC")                                         \
     BOOL_CONFIG  (ConfigLogEnabled,       "GCConfigLogEnabled",     NULL,                             false,             "Specifies the name of the GC config log file")                                           \
     BOOL_CONFIG  (GCNumaAware,            "GCNumaAware",            NULL,                             true,              "Enables numa allocations in the GC")                                                     \
+    INT_CONFIG   (GCNumaRemoteBalanceFactor, "GCNumaRemoteBalanceFactor", NULL,                       2,                 "Specifies how much harder it is to balance an allocation context to a heap on a remote " \
+                                                                                                                         "NUMA node; 0 keeps gen0 allocation strictly node-local")                                 \
     BOOL_CONFIG  (GCCpuGroup,             "GCCpuGroup",             "System.GC.CpuGroup",             false,             "Enables CPU groups in the GC")                                                           \
     BOOL_CONFIG  (GCLargePages,           "GCLargePages",           "System.GC.LargePages",           false,             "Enables using Large Pages in the GC")                                                    \
     INT_CONFIG   (HeapVerifyLevel,        "HeapVerify",             NULL,                             HEAPVERIFY_NONE,   "When set verifies the integrity of the managed heap on entry and exit of each GC")       \
@@ -82,6 +84,8 @@ public:
     INT_CONFIG   (LOHThreshold,           "GCLOHThreshold",         NULL,                             LARGE_OBJECT_SIZE, "Specifies the size that will make objects go on LOH")                                    \
     INT_CONFIG   (BGCSpinCount,           "BGCSpinCount",           NULL,                             140,               "Specifies the bgc spin count")                                                           \
     INT_CONFIG   (BGCSpin,                "BGCSpin",                NULL,                             2,                 "Specifies the bgc spin time")                                                            \
+    INT_CONFIG   (BGCSweepQuantum,        "BGCSweepQuantum",        NULL,                             256,               "Specifies the number of objects background sweep processes before checking for a "       \
+                                                                                                                         "pending EE suspension; smaller values favor latency over sweep throughput")              \
     INT_CONFIG   (HeapCount,              "GCHeapCount",            "System.GC.HeapCount",            0,                 "Specifies the number of server GC heaps")                                                \
     INT_CONFIG   (Gen0Size,               "GCgen0size",             NULL,                             0,                 "Specifies the smallest gen0 budget")                                                     \
     INT_CONFIG   (SegmentSize,            "GCSegmentSize",          NULL,                             0,                 "Specifies the managed heap segment size")                                                \
@@ -98,12 +102,21 @@ public:
     INT_CONFIG   (GCHighMemPercent,       "GCHighMemPercent",       "System.GC.HighMemoryPercent",    0,                 "The percent for GC to consider as high memory")                                          \
     INT_CONFIG   (GCProvModeStress,       "GCProvModeStress",       NULL,                             0,                 "Stress the provisional modes")                                                           \
     INT_CONFIG   (GCGen0MaxBudget,        "GCGen0MaxBudget",        NULL,                             0,                 "Specifies the largest gen0 allocation budget")                                           \
+    INT_CONFIG   (GCAllocationTickKB,     "GCAllocationTickKB",     NULL,                             0,                 "Overrides the allocation amount in KB that triggers the GCAllocationTick event; 0 "      \
+                                                                                                                         "keeps the default of 100KB")                                                             \
+    INT_CONFIG   (GCPauseBudgetMS,        "GCPauseBudgetMS",        NULL,                             0,                 "Specifies a soft pause budget for ephemeral GCs in milliseconds; generation budgets "    \
+                                                                                                                         "are shrunk when observed pauses exceed it")                                              \
     INT_CONFIG   (GCLowSkipRatio,         "GCLowSkipRatio",         NULL,                             30,                "Specifies the low generation skip ratio")                                                \
     INT_CONFIG   (GCHeapHardLimit,        "GCHeapHardLimit",        "System.GC.HeapHardLimit",        0,                 "Specifies a hard limit for the GC heap")                                                 \
     INT_CONFIG   (GCHeapHardLimitPercent, "GCHeapHardLimitPercent", "System.GC.HeapHardLimitPercent", 0,                 "Specifies the GC heap usage as a percentage of the total memory")                        \
+    INT_CONFIG   (GCHeapSoftLimit,        "GCHeapSoftLimit",        "System.GC.HeapSoftLimit",        0,                 "Specifies a soft limit for committed memory on the GC heap; going above it makes the "   \
+                                                                                                                         "GC compact and decommit more aggressively but does not fail allocations")                \
+    INT_CONFIG   (GCHeapSoftLimitPercent, "GCHeapSoftLimitPercent", "System.GC.HeapSoftLimitPercent", 0,                 "Specifies the GC heap soft limit as a percentage of the total memory")                   \
     INT_CONFIG   (GCTotalPhysicalMemory,  "GCTotalPhysicalMemory",  NULL,                             0,                 "Specifies what the GC should consider to be total physical memory")                      \
     INT_CONFIG   (GCRegionsRange,         "GCRegionsRange",         NULL,                             274877906944L,     "Specifies the range for the GC heap")                                                    \
     INT_CONFIG   (GCRegionsSize,          "GCRegionsSize",          NULL,                             4194304,           "Specifies the size for a basic GC region")                                               \
+    INT_CONFIG   (GCRegionsFreeCommit,    "GCRegionsFreeCommit",    NULL,                             16,                "Specifies how many committed free regions to retain per heap; regions returned to the "  \
+                                                                                                                         "free list beyond this count are decommitted")                                            \
     STRING_CONFIG(LogFile,                "GCLogFile",              NULL,                                                "Specifies the name of the GC log file")                                                  \
     STRING_CONFIG(ConfigLogFile,          "GCConfigLogFile",        NULL,                                                "Specifies the name of the GC config log file")                                           \
     INT_CONFIG   (BGCFLTuningEnabled,     "BGCFLTuningEnabled",     NULL,                             0,                 "Enables FL tuning")                                                                      \
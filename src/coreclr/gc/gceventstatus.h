@@ -213,11 +213,21 @@ void FireDynamicEvent(const char* name, EventArgument... arguments)
         return;
     }
 
-    uint8_t* buf = new (nothrow) uint8_t[size];
-    if (!buf)
+    // Dynamic event payloads are a handful of scalars, so serialize into a
+    // stack buffer and avoid allocating in the middle of a collection just
+    // because tracing is on. Oversized payloads fall back to the heap.
+    uint8_t stackBuffer[256];
+    uint8_t* heapBuffer = nullptr;
+    uint8_t* buf = stackBuffer;
+    if (size > sizeof(stackBuffer))
     {
-        // best effort - if we're OOM, don't bother with the event.
-        return;
+        heapBuffer = new (nothrow) uint8_t[size];
+        if (!heapBuffer)
+        {
+            // best effort - if we're OOM, don't bother with the event.
+            return;
+        }
+        buf = heapBuffer;
     }
 
     memset(buf, 0, size);
@@ -226,7 +236,7 @@ void FireDynamicEvent(const char* name, EventArgument... arguments)
     IGCToCLREventSink* sink = GCToEEInterface::EventSink();
     assert(sink != nullptr);
     sink->FireDynamicEvent(name, buf, static_cast<uint32_t>(size));
-    delete[] buf;
+    delete[] heapBuffer;
 };
 
 /*
@@ -6,12 +6,12 @@
 
 // The major version of the GC/EE interface. Breaking changes to this interface
 // require bumps in the major version number.
-#define GC_INTERFACE_MAJOR_VERSION 4
+#define GC_INTERFACE_MAJOR_VERSION 5
 
 // The minor version of the GC/EE interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interopate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 1
+#define GC_INTERFACE_MINOR_VERSION 0
 
 struct ScanContext;
 struct gc_alloc_context;
@@ -842,6 +842,16 @@ public:
     // Walk the heap object by object.
     virtual void DiagWalkHeap(walk_fn fn, void* context, int gen_number, bool walk_large_object_heap_p) = 0;
 
+    // Best-effort heap walk that does not require EE suspension. Only the stable
+    // portion of the heap is visited: generation max_generation excluding the
+    // ephemeral segment, plus the large and pinned object heaps. Each object header
+    // is validated before the callback is invoked and a range is abandoned at the
+    // first object that fails validation, so the walk tolerates in-flight
+    // allocations and concurrent sweeping at the cost of approximate results.
+    // The caller must prevent relocating collections for the duration of the walk,
+    // for example by calling on a thread in cooperative GC mode.
+    virtual void DiagWalkHeapWithoutSuspension(walk_fn fn, void* context) = 0;
+
     // Walks the survivors and get the relocation information if objects have moved.
     // gen_number is used when type == walk_for_uoh, otherwise ignored
     virtual void DiagWalkSurvivorsWithType(void* gc_context, record_surv_fn fn, void* diag_context, walk_surv_type type, int gen_number=-1) = 0;
@@ -106,6 +106,10 @@ inline void FATAL_GC_ERROR()
 #ifdef SERVER_GC
 #define MH_SC_MARK //scalable marking
 //#define SNOOP_STATS //diagnostic
+#else //SERVER_GC
+// Workstation GC marks with a single thread, so instead of parallelizing the mark
+// phase we hide its cache misses behind a small prefetch queue (see mark_queue_t).
+#define MARK_PHASE_PREFETCH
 #endif //SERVER_GC
 
 //This is used to mark some type volatile only when the scalable marking is used.
@@ -330,6 +334,27 @@ class sorted_table;
 class seg_free_spaces;
 class gc_heap;
 
+// The mark queue is a small circular buffer used by the mark phase to overlap the
+// cache misses incurred by marking. Rather than examining an object's mark bits as
+// soon as we discover a reference to it, we issue a prefetch for it and park it in
+// the queue; by the time the slot comes around again the prefetch has usually
+// completed and testing/setting the mark bits is cheap. Note that this makes
+// marking *deferred* - objects still sitting in the queue have not had their mark
+// bits set yet, so the queue must be drained (gc_heap::drain_mark_queue) before
+// anything looks at the mark bits.
+class mark_queue_t
+{
+    static const size_t slot_count = 16;
+    uint8_t* slot_table[slot_count];
+    size_t curr_slot_index;
+
+public:
+    mark_queue_t();
+    uint8_t* queue_mark (uint8_t* o);
+    uint8_t* get_next_marked ();
+    void verify_empty ();
+};
+
 #ifdef BACKGROUND_GC
 class exclusive_sync;
 class recursive_gc_sync;
@@ -1531,6 +1556,16 @@ protected:
     PER_HEAP
     void walk_heap_per_heap (walk_fn fn, void* context, int gen_number, BOOL walk_large_object_heap_p);
 
+    PER_HEAP_ISOLATED
+    void walk_heap_without_suspension (walk_fn fn, void* context);
+
+    PER_HEAP
+    void walk_heap_without_suspension_per_heap (walk_fn fn, void* context);
+
+    PER_HEAP
+    BOOL walk_diag_range_without_suspension (uint8_t* x, uint8_t* end, int align_const,
+                                             walk_fn fn, void* context);
+
     struct walk_relocate_args
     {
         uint8_t* last_plug;
@@ -2256,6 +2291,10 @@ protected:
     PER_HEAP
     BOOL gc_mark (uint8_t* o, uint8_t* low, uint8_t* high, int condemned_gen);
     PER_HEAP
+    uint8_t* mark_object_queued (uint8_t* o, uint8_t* low, uint8_t* high, int condemned_gen);
+    PER_HEAP
+    void drain_mark_queue ();
+    PER_HEAP
     void mark_object (uint8_t* o THREAD_NUMBER_DCL);
 #ifdef HEAP_ANALYZE
     PER_HEAP
@@ -3698,6 +3737,12 @@ public:
     PER_HEAP_ISOLATED
     bool gc_thread_no_affinitize_p;
 
+    // How strongly balance_heaps resists moving an allocation context to a heap on a
+    // remote NUMA node - the remote pass runs with delta scaled by this factor.
+    // 0 means never spill to a remote node.
+    PER_HEAP_ISOLATED
+    int numa_remote_balance_factor;
+
     PER_HEAP_ISOLATED
     GCEvent gc_start_event;
 
@@ -3889,6 +3934,19 @@ public:
     PER_HEAP_ISOLATED
     size_t heap_hard_limit_oh[total_oh_count - 1];
 
+    // Unlike the hard limit, going above the soft limit never fails an
+    // allocation - it just makes us condemn/compact more eagerly and
+    // decommit with less slack until we are back under it.
+    PER_HEAP_ISOLATED
+    size_t heap_soft_limit;
+
+    // Soft ephemeral pause budget in microseconds (0 means no budget).
+    // When the last collection of a generation exceeded this, the next
+    // allocation budget for that generation is shrunk proportionally so
+    // collections happen earlier and have less work to do.
+    PER_HEAP_ISOLATED
+    size_t pause_budget_us;
+
     PER_HEAP_ISOLATED
     CLRCriticalSection check_commit_cs;
 
@@ -3906,6 +3964,12 @@ public:
     PER_HEAP_ISOLATED
     bool use_large_pages_p;
 
+    // This is if the card table (and the other bookkeeping tables allocated
+    // with it) is backed by large pages, in which case it is fully committed
+    // up front and the mark array is not committed/decommitted per segment.
+    PER_HEAP_ISOLATED
+    bool card_table_use_large_pages_p;
+
 #ifdef HEAP_BALANCE_INSTRUMENTATION
     PER_HEAP_ISOLATED
     size_t last_gc_end_time_us;
@@ -3980,6 +4044,9 @@ protected:
     PER_HEAP
     mark*       mark_stack_array;
 
+    PER_HEAP
+    mark_queue_t mark_queue;
+
 #if defined (_DEBUG) && defined (VERIFY_HEAP)
     PER_HEAP
     BOOL       verify_pinned_queue_p;
@@ -58,6 +58,12 @@ void GCScan::GcDhInitialScan(promote_func* fn, int condemned, int max_gen, ScanC
     pDhContext->m_iMaxGen = max_gen;
     pDhContext->m_pScanContext = sc;
 
+    // Invalidate any worklist left over from the previous mark phase; the initial scan below rebuilds it
+    // (for non-concurrent GCs) while performing the first full walk of the dependent handles.
+    pDhContext->m_fWorklistValid = false;
+    pDhContext->m_fBuildingWorklist = false;
+    pDhContext->m_cWorklistEntries = 0;
+
     // Look for dependent handle whose primary has been promoted but whose secondary has not. Promote the
     // secondary in those cases. Additionally this scan sets the m_fUnpromotedPrimaries and m_fPromoted state
     // flags in the DH context. The m_fUnpromotedPrimaries flag is the most interesting here: if this flag is
@@ -22,12 +22,33 @@
 // select between them based on the ScanContext passed to us by the GC during the mark phase.
 struct DhContext
 {
+    // A dependent handle recorded as still awaiting secondary promotion. Entries are raw pointers to the
+    // handle's primary and secondary slots, which are stable for the duration of a non-concurrent mark
+    // phase (handles don't move and the EE is suspended).
+    struct DhPendingHandle
+    {
+        Object **pPrimaryRef;
+        Object **pSecondaryRef;
+    };
+
     bool            m_fUnpromotedPrimaries;     // Did last scan find at least one non-null unpromoted primary?
     bool            m_fPromoted;                // Did last scan promote at least one secondary?
     promote_func   *m_pfnPromoteFunction;       // GC promote callback to be used for all secondary promotions
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+
+    // During non-concurrent GCs the first full scan of the mark phase records every dependent handle whose
+    // primary was not yet promoted; re-scans then visit only those entries (dropping each one once its
+    // secondary has been promoted) instead of walking every handle block again. This makes fixpoint rounds
+    // proportional to the number of still-pending handles rather than the total handle population. The
+    // buffer persists across GCs to avoid reallocation; m_fWorklistValid is reset at the start of each mark
+    // phase and left false for concurrent scans or if growing the buffer fails, falling back to full scans.
+    DhPendingHandle *m_pWorklist;
+    size_t           m_cWorklistEntries;
+    size_t           m_cWorklistCapacity;
+    bool             m_fWorklistValid;
+    bool             m_fBuildingWorklist;
 };
 
 class GCScan
@@ -953,9 +953,9 @@ uint32_t HndCountHandles(HHANDLETABLE hTable)
     }
 
     // it is not necessary to have the lock while reading the quick cache;
-    // loop through the quick cache for each handle type
-    OBJECTHANDLE * pQuickCache = pTable->rgQuickCache;
-    OBJECTHANDLE * pQuickCacheEnd = pQuickCache + HANDLE_MAX_INTERNAL_TYPES;
+    // loop through the quick cache slots for each handle type
+    OBJECTHANDLE * pQuickCache = &pTable->rgQuickCache[0][0];
+    OBJECTHANDLE * pQuickCacheEnd = pQuickCache + (HANDLE_MAX_INTERNAL_TYPES * HANDLE_QUICK_CACHE_SLOTS);
     for (; pQuickCache != pQuickCacheEnd; ++pQuickCache)
         if (*pQuickCache)
             ++uCacheCount;
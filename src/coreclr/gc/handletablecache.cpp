@@ -28,6 +28,28 @@
  *
  ****************************************************************************/
 
+/*
+ * QuickCacheStartSlot
+ *
+ * Picks the preferred quick cache slot for the calling thread.  Threads
+ * running on different processors get different starting slots so that
+ * steady-state handle churn spreads over several cache lines instead of
+ * funneling through one interlocked slot.
+ *
+ */
+static uint32_t QuickCacheStartSlot()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    uint32_t uSlot = 0;
+
+    if (GCToOSInterface::CanGetCurrentProcessorNumber())
+        uSlot = GCToOSInterface::GetCurrentProcessorNumber() % HANDLE_QUICK_CACHE_SLOTS;
+
+    return uSlot;
+}
+
+
 /*
  * SpinUntil
  *
@@ -718,15 +740,21 @@ OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType
     // we use this in two places
     OBJECTHANDLE handle;
 
-    // first try to get a handle from the quick cache
-    if (pTable->rgQuickCache[uType])
+    // first try to get a handle from the quick cache, starting at this
+    // thread's preferred slot
+    uint32_t uStartSlot = QuickCacheStartSlot();
+    for (uint32_t n = 0; n < HANDLE_QUICK_CACHE_SLOTS; n++)
     {
-        // try to grab the handle we saw
-        handle = Interlocked::ExchangePointer(pTable->rgQuickCache + uType, (OBJECTHANDLE)NULL);
+        uint32_t uSlot = (uStartSlot + n) % HANDLE_QUICK_CACHE_SLOTS;
+        if (pTable->rgQuickCache[uType][uSlot])
+        {
+            // try to grab the handle we saw
+            handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uType][uSlot], (OBJECTHANDLE)NULL);
 
-        // if it worked then we're done
-        if (handle)
-            return handle;
+            // if it worked then we're done
+            if (handle)
+                return handle;
+        }
     }
 
     // ok, get the main handle cache for this type
@@ -786,15 +814,20 @@ void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHAN
     if (TypeHasUserData(pTable, uType))
         HandleQuickSetUserData(handle, 0L);
 
-    // is there room in the quick cache?
-    if (!pTable->rgQuickCache[uType])
+    // is there room in the quick cache? start at this thread's preferred slot
+    uint32_t uStartSlot = QuickCacheStartSlot();
+    for (uint32_t n = 0; n < HANDLE_QUICK_CACHE_SLOTS; n++)
     {
-        // yup - try to stuff our handle in the slot we saw
-        handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uType], handle);
+        uint32_t uSlot = (uStartSlot + n) % HANDLE_QUICK_CACHE_SLOTS;
+        if (!pTable->rgQuickCache[uType][uSlot])
+        {
+            // yup - try to stuff our handle in the slot we saw
+            handle = Interlocked::ExchangePointer(&pTable->rgQuickCache[uType][uSlot], handle);
 
-        // if we didn't end up with another handle then we're done
-        if (!handle)
-            return;
+            // if we didn't end up with another handle then we're done
+            if (!handle)
+                return;
+        }
     }
 
     // ok, get the main handle cache for this type
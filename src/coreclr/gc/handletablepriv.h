@@ -98,6 +98,11 @@ C_ASSERT (HANDLE_HANDLES_PER_MASK * 2 == HANDLE_HANDLES_PER_BLOCK);
 #define HANDLE_CACHE_TYPE_SIZE          128 // 128 == 63 handles per bank
 #define HANDLES_PER_CACHE_BANK          ((HANDLE_CACHE_TYPE_SIZE / 2) - 1)
 
+// number of sharded quick cache slots per handle type; threads running on
+// different processors prefer different slots, so steady-state handle churn
+// does not funnel through a single contended cache line
+#define HANDLE_QUICK_CACHE_SLOTS        8
+
 // cache policy defines
 #define REBALANCE_TOLERANCE             (HANDLES_PER_CACHE_BANK / 3)
 #define REBALANCE_LOWATER_MARK          (HANDLES_PER_CACHE_BANK - REBALANCE_TOLERANCE)
@@ -508,9 +513,10 @@ struct HandleTable
     uint32_t uTableIndex;
 
     /*
-     * one-level per-type 'quick' handle cache
+     * one-level per-type 'quick' handle cache, sharded into several slots so
+     * concurrent allocate/free churn spreads over multiple cache lines
      */
-    OBJECTHANDLE rgQuickCache[HANDLE_MAX_INTERNAL_TYPES];   // interlocked ops used here
+    OBJECTHANDLE rgQuickCache[HANDLE_MAX_INTERNAL_TYPES][HANDLE_QUICK_CACHE_SLOTS];   // interlocked ops used here
 
     /*
      * debug-only statistics
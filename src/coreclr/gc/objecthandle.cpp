@@ -182,6 +182,32 @@ void CALLBACK UpdateDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pE
 #endif
 }
 
+// Append a dependent handle whose primary is still unpromoted to the context's worklist so re-scans can
+// visit just the pending entries. Returns false (and invalidates worklist building) if the buffer cannot
+// be grown; the scan then falls back to full handle table walks.
+static bool DhAppendPendingHandle(DhContext *pDhContext, Object **pPrimaryRef, Object **pSecondaryRef)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pDhContext->m_cWorklistEntries == pDhContext->m_cWorklistCapacity)
+    {
+        size_t newCapacity = (pDhContext->m_cWorklistCapacity == 0) ? 256 : pDhContext->m_cWorklistCapacity * 2;
+        DhContext::DhPendingHandle *pNewList = new (nothrow) DhContext::DhPendingHandle[newCapacity];
+        if (pNewList == NULL)
+            return false;
+        if (pDhContext->m_cWorklistEntries != 0)
+            memcpy(pNewList, pDhContext->m_pWorklist, pDhContext->m_cWorklistEntries * sizeof(DhContext::DhPendingHandle));
+        delete [] pDhContext->m_pWorklist;
+        pDhContext->m_pWorklist = pNewList;
+        pDhContext->m_cWorklistCapacity = newCapacity;
+    }
+
+    pDhContext->m_pWorklist[pDhContext->m_cWorklistEntries].pPrimaryRef = pPrimaryRef;
+    pDhContext->m_pWorklist[pDhContext->m_cWorklistEntries].pSecondaryRef = pSecondaryRef;
+    pDhContext->m_cWorklistEntries++;
+    return true;
+}
+
 void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
 {
     LIMITED_METHOD_CONTRACT;
@@ -217,6 +243,14 @@ void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *p
         // promoted handles, so there's no chance of finding an additional handle being promoted on a
         // subsequent scan).
         pDhContext->m_fUnpromotedPrimaries = true;
+
+        // Remember the pending handle so re-scans can visit just the entries still awaiting promotion
+        // instead of walking every handle again.
+        if (pDhContext->m_fBuildingWorklist)
+        {
+            if (!DhAppendPendingHandle(pDhContext, pPrimaryRef, pSecondaryRef))
+                pDhContext->m_fBuildingWorklist = false;
+        }
     }
 }
 
@@ -642,6 +676,8 @@ bool Ref_Initialize()
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
 
+    ZeroMemory(g_pDependentHandleContexts, n_slots * sizeof(DhContext));
+
     return true;
 
 CleanupAndFail:
@@ -660,6 +696,8 @@ void Ref_Shutdown()
 
     if (g_pDependentHandleContexts)
     {
+        for (int i = 0; i < getNumberOfSlots(); i++)
+            delete [] g_pDependentHandleContexts[i].m_pWorklist;
         delete [] g_pDependentHandleContexts;
         g_pDependentHandleContexts = NULL;
     }
@@ -1220,28 +1258,72 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
         pDhContext->m_fUnpromotedPrimaries = false;
         pDhContext->m_fPromoted = false;
 
-        HandleTableMap *walk = &g_HandleTableMap;
-        while (walk)
+        if (pDhContext->m_fWorklistValid)
         {
-            for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+            // A previous full scan recorded every handle still awaiting promotion, so visit just those.
+            // Entries whose primary is now promoted get their secondary promoted and are dropped; the rest
+            // are compacted to the front of the worklist for the next round.
+            promote_func* callback = pDhContext->m_pfnPromoteFunction;
+            size_t cRemaining = 0;
+            for (size_t i = 0; i < pDhContext->m_cWorklistEntries; i++)
             {
-                if (walk->pBuckets[i] != NULL)
+                DhContext::DhPendingHandle pending = pDhContext->m_pWorklist[i];
+                if (*pending.pPrimaryRef == NULL)
+                    continue;
+
+                if (g_theGCHeap->IsPromoted(*pending.pPrimaryRef))
                 {
-                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(pDhContext->m_pScanContext)];
-                    if (hTable)
+                    if (!g_theGCHeap->IsPromoted(*pending.pSecondaryRef))
                     {
-                        HndScanHandlesForGC(hTable,
-                                            PromoteDependentHandle,
-                                            uintptr_t(pDhContext->m_pScanContext),
-                                            uintptr_t(pDhContext->m_pfnPromoteFunction),
-                                            &type, 1,
-                                            pDhContext->m_iCondemned,
-                                            pDhContext->m_iMaxGen,
-                                            flags );
+                        callback(pending.pSecondaryRef, pDhContext->m_pScanContext, 0);
+                        pDhContext->m_fPromoted = true;
                     }
                 }
+                else
+                {
+                    pDhContext->m_fUnpromotedPrimaries = true;
+                    pDhContext->m_pWorklist[cRemaining++] = pending;
+                }
             }
-            walk = walk->pNext;
+            pDhContext->m_cWorklistEntries = cRemaining;
+        }
+        else
+        {
+            // Full walk of every dependent handle. During non-concurrent GCs, record the pending handles
+            // as we go so subsequent rounds can use the worklist path above; handle slots are stable for
+            // the rest of the mark phase since the EE is suspended. Concurrent scans can observe handle
+            // creation and destruction between rounds, so they always re-walk the tables.
+            pDhContext->m_fBuildingWorklist = !pDhContext->m_pScanContext->concurrent;
+            pDhContext->m_cWorklistEntries = 0;
+
+            HandleTableMap *walk = &g_HandleTableMap;
+            while (walk)
+            {
+                for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
+                {
+                    if (walk->pBuckets[i] != NULL)
+                    {
+                        HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(pDhContext->m_pScanContext)];
+                        if (hTable)
+                        {
+                            HndScanHandlesForGC(hTable,
+                                                PromoteDependentHandle,
+                                                uintptr_t(pDhContext->m_pScanContext),
+                                                uintptr_t(pDhContext->m_pfnPromoteFunction),
+                                                &type, 1,
+                                                pDhContext->m_iCondemned,
+                                                pDhContext->m_iMaxGen,
+                                                flags );
+                        }
+                    }
+                }
+                walk = walk->pNext;
+            }
+
+            // If the walk recorded every pending handle without an allocation failure, later rounds (and
+            // later calls from the GC during this mark phase) can use the worklist.
+            pDhContext->m_fWorklistValid = pDhContext->m_fBuildingWorklist;
+            pDhContext->m_fBuildingWorklist = false;
         }
 
         if (pDhContext->m_fPromoted)
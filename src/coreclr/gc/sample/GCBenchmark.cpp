@@ -0,0 +1,343 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBenchmark.cpp
+//
+
+//
+//  A small deterministic benchmark driver for the standalone GC, built on the
+//  same minimal environment as GCSample. It exercises the collector against
+//  configurable heap shapes without standing up the full runtime:
+//
+//  * a seeded generator builds linked object graphs with a byte-array payload
+//    per node, so runs are reproducible bit for bit;
+//  * the survivor and pinning rates are configurable, which controls how much
+//    work the mark/plan/compact phases see per collection;
+//  * allocation throughput and induced per-generation pause times are written
+//    as CSV to stdout for diffing across builds.
+//
+//  Usage:
+//      gcbench [nodes] [iterations] [survivorPerMille] [pinPerMille] [payloadMax]
+//
+//  Per-phase (mark/plan/relocate/compact/sweep) breakdowns intentionally stay
+//  out of this harness: they would require reaching into gc_heap internals
+//  from gcpriv.h. The GCPerHeapHistory ETW/EventPipe events already expose
+//  those timings, and this driver provides the reproducible heap shapes to
+//  capture them against.
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+Object * AllocateObject(MethodTable * pMT, size_t size)
+{
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    Object * pObject;
+
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if (advance <= acontext->alloc_limit)
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        pObject = g_theGCHeap->Alloc(acontext, size, 0);
+        if (pObject == NULL)
+            return NULL;
+    }
+
+    pObject->RawSetMethodTable(pMT);
+
+    return pObject;
+}
+
+#if defined(HOST_64BIT)
+// Card byte shift is different on 64bit.
+#define card_byte_shift     11
+#else
+#define card_byte_shift     10
+#endif
+
+#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
+
+inline void ErectWriteBarrier(Object ** dst, Object * ref)
+{
+    // if the dst is outside of the heap (unboxed value classes) then we
+    //      simply exit
+    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
+        return;
+
+    // volatile is used here to prevent fetch of g_card_table from being reordered
+    // with g_lowest/highest_address check above. See comments in StompWriteBarrier
+    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
+    if(*pCardByte != 0xFF)
+        *pCardByte = 0xFF;
+}
+
+void WriteBarrier(Object ** dst, Object * ref)
+{
+    *dst = ref;
+    ErectWriteBarrier(dst, ref);
+}
+
+//
+// A deterministic xorshift generator; the seed is fixed so two runs of the
+// same build and arguments allocate identical graphs.
+//
+static uint64_t s_randomState = 0x9E3779B97F4A7C15;
+
+static uint64_t NextRandom()
+{
+    uint64_t x = s_randomState;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    s_randomState = x;
+    return x;
+}
+
+static int64_t ElapsedMicroseconds(int64_t start, int64_t end)
+{
+    static int64_t frequency = GCToOSInterface::QueryPerformanceFrequency();
+    return (end - start) * (int64_t)1000000 / frequency;
+}
+
+static OBJECTHANDLE CreateHandleOfType(Object * pObject, HandleType type)
+{
+    return HndCreateHandle(g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()], type, pObject);
+}
+
+//
+// The node type forming the graph: two object references followed by
+// non-reference padding, described by a single GCDesc series.
+//
+class Node : Object {
+public:
+    Object * m_pNext;
+    Object * m_pPayload;
+    size_t m_id;
+};
+
+static struct Node_MethodTable
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+}
+Node_MethodTable;
+
+// Reference-free byte array used as variable-size payload and as the pinned
+// object population.
+static MethodTable ByteArray_MethodTable;
+
+static Object * AllocateNode()
+{
+    return AllocateObject(&Node_MethodTable.m_MT, Node_MethodTable.m_MT.GetBaseSize());
+}
+
+static Object * AllocateByteArray(uint32_t numComponents)
+{
+    size_t size = ByteArray_MethodTable.GetBaseSize() + numComponents;
+    size = (size + (sizeof(void *) - 1)) & ~(sizeof(void *) - 1);
+
+    Object * pObject = AllocateObject(&ByteArray_MethodTable, size);
+    if (pObject == NULL)
+        return NULL;
+
+    *(uint32_t *)((uint8_t *)pObject + ArrayBase::GetOffsetOfNumComponents()) = numComponents;
+
+    return pObject;
+}
+
+extern "C" HRESULT GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+
+int __cdecl main(int argc, char* argv[])
+{
+    size_t nodeCount        = (argc > 1) ? (size_t)atoll(argv[1]) : 500000;
+    int    iterations       = (argc > 2) ? atoi(argv[2]) : 5;
+    int    survivorPerMille = (argc > 3) ? atoi(argv[3]) : 50;
+    int    pinPerMille      = (argc > 4) ? atoi(argv[4]) : 5;
+    uint32_t payloadMax     = (argc > 5) ? (uint32_t)atoi(argv[5]) : 256;
+
+    if (nodeCount == 0 || iterations <= 0 || survivorPerMille < 0 || survivorPerMille > 1000 ||
+        pinPerMille < 0 || pinPerMille > 1000 || payloadMax == 0)
+    {
+        fprintf(stderr, "usage: gcbench [nodes] [iterations] [survivorPerMille] [pinPerMille] [payloadMax]\n");
+        return -1;
+    }
+
+    //
+    // Initialize system info
+    //
+    if (!GCToOSInterface::Initialize())
+    {
+        return -1;
+    }
+
+    //
+    // Initialize GC heap
+    //
+    GcDacVars dacVars;
+    IGCHeap *pGCHeap;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(pGCHeap->Initialize()))
+        return -1;
+
+    //
+    // Initialize handle manager
+    //
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    //
+    // Initialize current thread
+    //
+    ThreadStore::AttachCurrentThread();
+
+    //
+    // Build the method tables.
+    //
+    uint32_t baseSize = sizeof(Node);
+    // GC expects the size of ObjHeader (extra void*) to be included in the size.
+    baseSize = baseSize + sizeof(ObjHeader);
+    // Add padding as necessary. GC requires the object size to be at least MIN_OBJECT_SIZE.
+    Node_MethodTable.m_MT.m_baseSize = max(baseSize, MIN_OBJECT_SIZE);
+
+    Node_MethodTable.m_MT.m_componentSize = 0;    // Array component size
+    Node_MethodTable.m_MT.m_flags = MTFlag_ContainsPointers;
+
+    Node_MethodTable.m_numSeries = 1;
+    Node_MethodTable.m_series[0].SetSeriesOffset(offsetof(Node, m_pNext));
+    Node_MethodTable.m_series[0].SetSeriesCount(2);
+    Node_MethodTable.m_series[0].seriessize -= Node_MethodTable.m_MT.m_baseSize;
+
+    uint32_t arrayBaseSize = sizeof(ArrayBase) + sizeof(ObjHeader);
+    ByteArray_MethodTable.m_baseSize = max(arrayBaseSize, MIN_OBJECT_SIZE);
+    ByteArray_MethodTable.m_flags = MTFlag_HasComponentSize | MTFlag_IsArray;
+    ByteArray_MethodTable.m_componentSize = 1;
+
+    //
+    // Root storage: survivor handles age graphs across iterations, pin handles
+    // hold byte arrays in place to create fragmentation for plan/compact.
+    //
+    size_t survivorSlots = (nodeCount * (size_t)survivorPerMille) / 1000;
+    size_t pinSlots      = (nodeCount * (size_t)pinPerMille) / 1000;
+
+    OBJECTHANDLE * pSurvivors = (survivorSlots != 0) ? new (std::nothrow) OBJECTHANDLE[survivorSlots] : NULL;
+    OBJECTHANDLE * pPins      = (pinSlots != 0) ? new (std::nothrow) OBJECTHANDLE[pinSlots] : NULL;
+
+    if ((survivorSlots != 0 && pSurvivors == NULL) || (pinSlots != 0 && pPins == NULL))
+        return -1;
+
+    for (size_t i = 0; i < survivorSlots; i++)
+        pSurvivors[i] = NULL;
+    for (size_t i = 0; i < pinSlots; i++)
+        pPins[i] = NULL;
+
+    printf("phase,iteration,gen,nodes,elapsed_us,bytes_in_use\n");
+
+    for (int iteration = 0; iteration < iterations; iteration++)
+    {
+        int64_t allocStart = GCToOSInterface::QueryPerformanceCounter();
+
+        for (size_t i = 0; i < nodeCount; i++)
+        {
+            Node * pNode = (Node *)AllocateNode();
+            if (pNode == NULL)
+                return -1;
+
+            // The payload allocation may trigger a collection that moves the
+            // node, so root the node in a handle across it.
+            OBJECTHANDLE ohNode = CreateHandleOfType((Object *)pNode, HNDTYPE_DEFAULT);
+            if (ohNode == NULL)
+                return -1;
+
+            uint32_t payloadSize = (uint32_t)(NextRandom() % payloadMax) + 1;
+            Object * pPayload = AllocateByteArray(payloadSize);
+            if (pPayload == NULL)
+                return -1;
+
+            pNode = (Node *)HndFetchHandle(ohNode);
+            WriteBarrier(&pNode->m_pPayload, pPayload);
+            pNode->m_id = i;
+
+            uint64_t roll = NextRandom() % 1000;
+
+            // A slice of nodes survives: link it into a random survivor slot,
+            // displacing (and thereby killing) the graph rooted there before.
+            if (survivorSlots != 0 && roll < (uint64_t)survivorPerMille)
+            {
+                size_t slot = (size_t)(NextRandom() % survivorSlots);
+                if (pSurvivors[slot] == NULL)
+                {
+                    pSurvivors[slot] = CreateHandleOfType((Object *)pNode, HNDTYPE_DEFAULT);
+                    if (pSurvivors[slot] == NULL)
+                        return -1;
+                }
+                else
+                {
+                    Node * pPrev = (Node *)HndFetchHandle(pSurvivors[slot]);
+                    WriteBarrier(&pNode->m_pNext, (Object *)pPrev);
+                    HndAssignHandle(pSurvivors[slot], (Object *)pNode);
+                }
+            }
+
+            // A smaller slice of payloads gets pinned, cycling through the pin
+            // slots so pins appear and disappear over the run.
+            if (pinSlots != 0 && roll >= (uint64_t)(1000 - pinPerMille))
+            {
+                size_t slot = (size_t)(NextRandom() % pinSlots);
+                if (pPins[slot] != NULL)
+                    HndDestroyHandle(HndGetHandleTable(pPins[slot]), HNDTYPE_PINNED, pPins[slot]);
+                pPins[slot] = CreateHandleOfType(pPayload, HNDTYPE_PINNED);
+                if (pPins[slot] == NULL)
+                    return -1;
+            }
+
+            HndDestroyHandle(HndGetHandleTable(ohNode), HNDTYPE_DEFAULT, ohNode);
+        }
+
+        int64_t allocEnd = GCToOSInterface::QueryPerformanceCounter();
+
+        printf("alloc,%d,-1,%zu,%lld,%zu\n",
+               iteration,
+               nodeCount,
+               (long long)ElapsedMicroseconds(allocStart, allocEnd),
+               pGCHeap->GetTotalBytesInUse());
+
+        // Time an induced blocking collection of each generation against the
+        // heap shape this iteration produced.
+        for (int gen = 0; gen <= 2; gen++)
+        {
+            int64_t gcStart = GCToOSInterface::QueryPerformanceCounter();
+            pGCHeap->GarbageCollect(gen);
+            int64_t gcEnd = GCToOSInterface::QueryPerformanceCounter();
+
+            printf("induced,%d,%d,%zu,%lld,%zu\n",
+                   iteration,
+                   gen,
+                   nodeCount,
+                   (long long)ElapsedMicroseconds(gcStart, gcEnd),
+                   pGCHeap->GetTotalBytesInUse());
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+
+#include <arm_neon.h>
+
+#include "do_vxsort.h"
+
+// NEON flavor of the mark-list sorter.
+//
+// This deliberately does not instantiate the vxsort<> template machinery: the
+// AVX2/AVX512 partition loops there are built around masked loads and
+// compress-store style permutation tables that have no NEON equivalent, and
+// NEON's 128-bit width makes the 32-bit packing scheme much less profitable.
+// Instead this is a pivot-based sort whose leaves are sorted with a fully
+// vectorized bitonic network on int64x2_t lanes - which is where the bulk of
+// the comparisons happen for mark lists - so ARM64 still gets most of the
+// sorted-mark-list win instead of falling all the way back to introsort.
+//
+// SVE would allow the real partition loop to be ported (it has compact/splice),
+// but the minimum toolchains we build with cannot target SVE yet, so that is
+// left for a future change.
+
+namespace {
+
+const int NEON_LEAF_SORT_ELEMENTS = 64;
+
+inline int64x2_t neon_min (int64x2_t a, int64x2_t b)
+{
+    return vbslq_s64 (vcgtq_s64 (a, b), b, a);
+}
+
+inline int64x2_t neon_max (int64x2_t a, int64x2_t b)
+{
+    return vbslq_s64 (vcgtq_s64 (a, b), a, b);
+}
+
+// Sorts items[0..n-1] where n is a power of two <= NEON_LEAF_SORT_ELEMENTS,
+// using the classic bitonic network. All compare-exchange stages run two
+// elements per operation; the stride-1 stage stays in registers.
+void bitonic_sort_neon (int64_t* items, int n)
+{
+    for (int k = 2; k <= n; k <<= 1)
+    {
+        for (int j = k >> 1; j > 0; j >>= 1)
+        {
+            if (j >= 2)
+            {
+                for (int i = 0; i < n; i += 2)
+                {
+                    if ((i & j) != 0)
+                        continue;
+
+                    int64x2_t a = vld1q_s64 (items + i);
+                    int64x2_t b = vld1q_s64 (items + (i ^ j));
+                    int64x2_t mn = neon_min (a, b);
+                    int64x2_t mx = neon_max (a, b);
+                    if ((i & k) == 0)
+                    {
+                        vst1q_s64 (items + i, mn);
+                        vst1q_s64 (items + (i ^ j), mx);
+                    }
+                    else
+                    {
+                        vst1q_s64 (items + i, mx);
+                        vst1q_s64 (items + (i ^ j), mn);
+                    }
+                }
+            }
+            else
+            {
+                for (int i = 0; i < n; i += 2)
+                {
+                    int64x2_t v = vld1q_s64 (items + i);
+                    int64x2_t r = vextq_s64 (v, v, 1);
+                    int64x2_t mn = neon_min (v, r);
+                    int64x2_t mx = neon_max (v, r);
+                    int64x2_t res = ((i & k) == 0) ? vzip1q_s64 (mn, mx)
+                                                   : vzip1q_s64 (mx, mn);
+                    vst1q_s64 (items + i, res);
+                }
+            }
+        }
+    }
+}
+
+// Leaf sort: copy into a sentinel-padded power-of-two buffer, run the bitonic
+// network, copy back. count must be <= NEON_LEAF_SORT_ELEMENTS.
+void leaf_sort_neon (int64_t* low, int64_t* high)
+{
+    int count = (int)(high - low + 1);
+    assert (count <= NEON_LEAF_SORT_ELEMENTS);
+
+    if (count < 2)
+        return;
+
+    int n = 2;
+    while (n < count)
+        n <<= 1;
+
+    int64_t buffer[NEON_LEAF_SORT_ELEMENTS];
+    memcpy (buffer, low, count * sizeof (int64_t));
+    for (int i = count; i < n; i++)
+    {
+        buffer[i] = INT64_MAX;
+    }
+
+    bitonic_sort_neon (buffer, n);
+
+    memcpy (low, buffer, count * sizeof (int64_t));
+}
+
+void heap_sift_down (int64_t* items, ptrdiff_t start, ptrdiff_t end)
+{
+    ptrdiff_t root = start;
+    while (root * 2 + 1 <= end)
+    {
+        ptrdiff_t child = root * 2 + 1;
+        if ((child < end) && (items[child] < items[child + 1]))
+            child++;
+        if (items[root] >= items[child])
+            return;
+        int64_t t = items[root];
+        items[root] = items[child];
+        items[child] = t;
+        root = child;
+    }
+}
+
+// Depth-limit fallback so adversarial inputs cannot drive the quicksort quadratic.
+void heap_sort_neon (int64_t* low, int64_t* high)
+{
+    ptrdiff_t n = high - low + 1;
+    for (ptrdiff_t i = n / 2 - 1; i >= 0; i--)
+    {
+        heap_sift_down (low, i, n - 1);
+    }
+    for (ptrdiff_t i = n - 1; i >= 1; i--)
+    {
+        int64_t t = low[0];
+        low[0] = low[i];
+        low[i] = t;
+        heap_sift_down (low, 0, i - 1);
+    }
+}
+
+inline void swap_elements (int64_t* a, int64_t* b)
+{
+    int64_t t = *a;
+    *a = *b;
+    *b = t;
+}
+
+void sort_neon (int64_t* low, int64_t* high, int depth_limit)
+{
+    while ((high - low + 1) > NEON_LEAF_SORT_ELEMENTS)
+    {
+        if (depth_limit == 0)
+        {
+            heap_sort_neon (low, high);
+            return;
+        }
+        depth_limit--;
+
+        // median-of-three pivot, stored at *low
+        int64_t* mid = low + ((high - low) / 2);
+        if (*mid < *low)
+            swap_elements (mid, low);
+        if (*high < *low)
+            swap_elements (high, low);
+        if (*high < *mid)
+            swap_elements (high, mid);
+        swap_elements (low, mid);
+
+        int64_t pivot = *low;
+        int64_t* left = low;
+        int64_t* right = high + 1;
+        while (true)
+        {
+            do
+            {
+                left++;
+            } while ((left <= high) && (*left < pivot));
+            do
+            {
+                right--;
+            } while (*right > pivot);
+            if (left > right)
+                break;
+            swap_elements (left, right);
+        }
+        swap_elements (low, right);
+
+        // recurse on the smaller side, iterate on the larger one to bound stack depth
+        if ((right - low) < (high - right))
+        {
+            sort_neon (low, right - 1, depth_limit);
+            low = right + 1;
+        }
+        else
+        {
+            sort_neon (right + 1, high, depth_limit);
+            high = right - 1;
+        }
+    }
+
+    leaf_sort_neon (low, high);
+}
+
+int floor_log2_plus_one (size_t n)
+{
+    int result = 0;
+    while (n >= 1)
+    {
+        result++;
+        n = n / 2;
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+void do_vxsort_neon (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high)
+{
+    // the range is not needed for partitioning the way the AVX flavors use it,
+    // but keep the contract identical so the call site stays uniform
+    (void)range_low;
+    (void)range_high;
+
+    int depth_limit = 2 * floor_log2_plus_one (high - low + 1);
+    sort_neon ((int64_t*)low, (int64_t*)high, depth_limit);
+}
@@ -698,6 +698,124 @@ BOOL Assembler::EmitFieldsMethods(Class* pClass)
     return ret;
 }
 
+// Hash index over one class's method and field definitions, built lazily the first
+// time a local member ref targets that class. Round-tripped IL carries a member ref
+// for nearly every call site, and resolving each of them with a linear scan of the
+// defining class made ResolveLocalMemberRefs quadratic for large classes.
+// Bucket chains preserve definition order so duplicate name+signature pairs
+// (e.g. privatescope methods) resolve to the same definition the linear scan found.
+class LocalMemberDefIndex
+{
+public:
+    LocalMemberDefIndex(Class* pClass)
+    {
+        memset(m_Table, 0, sizeof(m_Table));
+
+        int i;
+        Method* pMD;
+        FieldDescriptor* pFD;
+        // Prepend in reverse definition order, so each chain ends up in definition order
+        for(i = pClass->m_FieldDList.COUNT()-1; i >= 0; i--)
+        {
+            pFD = pClass->m_FieldDList.PEEK(i);
+            ULONG cSig = pFD->m_pbsSig ? pFD->m_pbsSig->length() : 0;
+            PCOR_SIGNATURE pSig = pFD->m_pbsSig ? (PCOR_SIGNATURE)(pFD->m_pbsSig->ptr()) : NULL;
+            Prepend(pFD->m_szName, pFD->m_dwName, cSig, pSig, NULL, pFD);
+        }
+        for(i = pClass->m_MethodList.COUNT()-1; i >= 0; i--)
+        {
+            pMD = pClass->m_MethodList.PEEK(i);
+            Prepend(pMD->m_szName, pMD->m_dwName, pMD->m_dwMethodCSig, pMD->m_pMethodSig, pMD, NULL);
+        }
+    }
+
+    ~LocalMemberDefIndex()
+    {
+        for(unsigned i = 0; i < TABLE_SIZE; i++)
+        {
+            Entry* pE = m_Table[i];
+            while(pE)
+            {
+                Entry* pNext = pE->pNext;
+                delete pE;
+                pE = pNext;
+            }
+        }
+    }
+
+    Method* FindMethod(char* szName, DWORD dwName, ULONG cSig, PCOR_SIGNATURE pSig)
+    {
+        for(Entry* pE = m_Table[Bucket(szName, dwName)]; pE; pE = pE->pNext)
+        {
+            if(pE->pMD == NULL) continue;
+            if(pE->dwName != dwName) continue;
+            if(strcmp(pE->szName, szName)) continue;
+            if(pE->cSig != cSig) continue;
+            if(memcmp(pE->pSig, pSig, cSig)) continue;
+            return pE->pMD;
+        }
+        return NULL;
+    }
+
+    FieldDescriptor* FindField(char* szName, DWORD dwName, ULONG cSig, PCOR_SIGNATURE pSig)
+    {
+        for(Entry* pE = m_Table[Bucket(szName, dwName)]; pE; pE = pE->pNext)
+        {
+            if(pE->pFD == NULL) continue;
+            if(pE->dwName != dwName) continue;
+            if(strcmp(pE->szName, szName)) continue;
+            if(pE->pSig)
+            {
+                if(pE->cSig != cSig) continue;
+                if(memcmp(pE->pSig, pSig, cSig)) continue;
+            }
+            else if(cSig) continue;
+            return pE->pFD;
+        }
+        return NULL;
+    }
+
+private:
+    static const unsigned TABLE_SIZE = 512; // must be a power of two
+
+    struct Entry
+    {
+        char*           szName;
+        DWORD           dwName; // name length
+        ULONG           cSig;
+        PCOR_SIGNATURE  pSig;
+        Method*         pMD;
+        FieldDescriptor* pFD;
+        Entry*          pNext;
+    };
+
+    Entry* m_Table[TABLE_SIZE];
+
+    static unsigned Bucket(const char* szName, DWORD dwName)
+    {
+        // The signature deliberately doesn't participate in the hash: a field
+        // definition with no signature must land in the same bucket as the refs
+        // it matches regardless of their signature length
+        unsigned hash = 0;
+        for(DWORD i = 0; i < dwName; i++) hash = hash*31 + (unsigned char)szName[i];
+        return hash & (TABLE_SIZE-1);
+    }
+
+    void Prepend(char* szName, DWORD dwName, ULONG cSig, PCOR_SIGNATURE pSig, Method* pMD, FieldDescriptor* pFD)
+    {
+        Entry* pE = new Entry();
+        pE->szName = szName;
+        pE->dwName = dwName;
+        pE->cSig = cSig;
+        pE->pSig = pSig;
+        pE->pMD = pMD;
+        pE->pFD = pFD;
+        unsigned bucket = Bucket(szName, dwName);
+        pE->pNext = m_Table[bucket];
+        m_Table[bucket] = pE;
+    }
+};
+
 HRESULT Assembler::ResolveLocalMemberRefs()
 {
     unsigned ulTotal=0, ulDefs=0, ulRefs=0, ulUnres=0;
@@ -707,10 +825,20 @@ HRESULT Assembler::ResolveLocalMemberRefs()
     {
         MemberRefDescriptor*    pMRD;
         mdToken         tkMemberDef = 0;
-        int i,j,k;
+        int i,k;
         Class   *pSearch;
 
         if(m_fReportProgress) printf("Resolving local member refs: ");
+
+        // Per-class definition indexes, built on first use and dropped when done
+        ULONG nIndexes = m_lstClass.COUNT();
+        LocalMemberDefIndex** ppIndexes = NULL;
+        if(nIndexes)
+        {
+            ppIndexes = new LocalMemberDefIndex*[nIndexes];
+            memset(ppIndexes, 0, nIndexes * sizeof(LocalMemberDefIndex*));
+        }
+
         for(k=0; k<2; k++)
         {
             for(i=0; (pMRD = pList[k]->PEEK(i)) != NULL; i++)
@@ -738,6 +866,12 @@ HRESULT Assembler::ResolveLocalMemberRefs()
                 }
                 if(pSearch)
                 {
+                    // Build (or fetch) the definition index of the target class
+                    ULONG iClass = (pMRD->m_tdClass == mdTokenNil) ? 0 : RidFromToken(pMRD->m_tdClass)-1;
+                    _ASSERTE(iClass < nIndexes);
+                    if(ppIndexes[iClass] == NULL)
+                        ppIndexes[iClass] = new LocalMemberDefIndex(pSearch);
+
                     // MemberRef may reference a method or a field
                     if(k==0) //methods
                     {
@@ -749,15 +883,11 @@ HRESULT Assembler::ResolveLocalMemberRefs()
                             pMRD_pSig = (PCOR_SIGNATURE)(qbSig.Ptr());
                             pMRD_dwCSig = L;
                         }
-                        for(j=0; (pListMD = pSearch->m_MethodList.PEEK(j)) != NULL; j++)
+                        pListMD = ppIndexes[iClass]->FindMethod(pMRD_szName, pMRD_dwName, pMRD_dwCSig, pMRD_pSig);
+                        if(pListMD)
                         {
-                            if(pListMD->m_dwName != pMRD_dwName) continue;
-                            if(strcmp(pListMD->m_szName,pMRD_szName)) continue;
-                            if(pListMD->m_dwMethodCSig  != pMRD_dwCSig)  continue;
-                            if(memcmp(pListMD->m_pMethodSig,pMRD_pSig,pMRD_dwCSig)) continue;
                             tkMemberDef = pListMD->m_Tok;
                             ulDefs++;
-                            break;
                         }
                         if(tkMemberDef && ((*pMRD_pSig & IMAGE_CEE_CS_CALLCONV_MASK)==IMAGE_CEE_CS_CALLCONV_VARARG))
                         {
@@ -779,20 +909,11 @@ HRESULT Assembler::ResolveLocalMemberRefs()
                     }
                     else   // fields
                     {
-                        FieldDescriptor* pListFD;
-                        for(j=0; (pListFD = pSearch->m_FieldDList.PEEK(j)) != NULL; j++)
+                        FieldDescriptor* pListFD = ppIndexes[iClass]->FindField(pMRD_szName, pMRD_dwName, pMRD_dwCSig, pMRD_pSig);
+                        if(pListFD)
                         {
-                            if(pListFD->m_dwName != pMRD_dwName) continue;
-                            if(strcmp(pListFD->m_szName,pMRD_szName)) continue;
-                            if(pListFD->m_pbsSig)
-                            {
-                                if(pListFD->m_pbsSig->length()  != pMRD_dwCSig)  continue;
-                                if(memcmp(pListFD->m_pbsSig->ptr(),pMRD_pSig,pMRD_dwCSig)) continue;
-                            }
-                            else if(pMRD_dwCSig) continue;
                             tkMemberDef = pListFD->m_fdFieldTok;
                             ulDefs++;
-                            break;
                         }
                     }
                 }
@@ -825,6 +946,14 @@ HRESULT Assembler::ResolveLocalMemberRefs()
                 pMRD->m_tkResolved = tkMemberDef;
             }
         }
+        if(ppIndexes)
+        {
+            for(ULONG ix = 0; ix < nIndexes; ix++)
+            {
+                if(ppIndexes[ix]) delete ppIndexes[ix];
+            }
+            delete [] ppIndexes;
+        }
         for(i=0; (pMRD = m_MethodSpecList.PEEK(i)) != NULL; i++)
         {
             if(pMRD->m_tkResolved) continue;
@@ -7349,6 +7349,10 @@ FILE* OpenOutput(__in __nullterminated const WCHAR* wzFileName)
 
     if(pfile)
     {
+        // The disassembly is written a line at a time; give the stream a large
+        // buffer so batch runs over big assemblies aren't dominated by small
+        // writes to the output file.
+        setvbuf(pfile,NULL,_IOFBF,1024*1024);
         if(g_uCodePage == CP_UTF8) fwrite("\357\273\277",3,1,pfile);
         else if(g_uCodePage == 0xFFFFFFFF) fwrite("\377\376",2,1,pfile);
     }
@@ -0,0 +1,37 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//*****************************************************************************
+// cachelineaudit.h
+//
+// Debug-only registry of globals and fields that are candidates for cache line
+// contention. Components register the variables they believe are (or must not
+// be) contended; the report sorts the registered addresses and flags entries
+// that landed on the same cache line, so a cross-structure padding regression
+// shows up in a checked build run instead of as false sharing on real machines.
+//
+// The report is requested with DOTNET_AuditCacheLines=1 and is written to
+// stderr at the end of EE startup. Besides the sharing warnings it dumps one
+// name/address/size line per entry, which can be correlated against perf c2c
+// style cache line profiles of a live process.
+//*****************************************************************************
+
+#ifndef __CACHELINEAUDIT_H__
+#define __CACHELINEAUDIT_H__
+
+#ifdef _DEBUG
+
+void CacheLineAuditRegister(LPCSTR name, const void* address, size_t size);
+void CacheLineAuditReport();
+
+// Registers a global or field under its own name. Registration is cheap (one
+// array store), so call sites do not need to be gated on the config value.
+#define CACHE_LINE_AUDIT(var) CacheLineAuditRegister(#var, &(var), sizeof(var))
+
+#else // _DEBUG
+
+#define CACHE_LINE_AUDIT(var)
+
+#endif // _DEBUG
+
+#endif // __CACHELINEAUDIT_H__
@@ -239,6 +239,7 @@ CONFIG_DWORD_INFO(INTERNAL_DbgNativeCodeBpBindsAcrossVersions, W("DbgNativeCodeB
 ///
 /// Diagnostics (internal general-purpose)
 ///
+CONFIG_DWORD_INFO(INTERNAL_AuditCacheLines, W("AuditCacheLines"), 0, "If set, reports registered globals/fields that share a cache line at the end of EE startup. See cachelineaudit.h.")
 CONFIG_DWORD_INFO(INTERNAL_ConditionalContracts, W("ConditionalContracts"), 0, "If ENABLE_CONTRACTS_IMPL is defined, sets whether contracts are conditional. (?)")
 CONFIG_DWORD_INFO(INTERNAL_ConsistencyCheck, W("ConsistencyCheck"), 0, "")
 CONFIG_DWORD_INFO(INTERNAL_ContinueOnAssert, W("ContinueOnAssert"), 0, "If set, doesn't break on asserts.")
@@ -281,6 +282,8 @@ CONFIG_DWORD_INFO(INTERNAL_GcStressOnDirectCalls, W("GcStressOnDirectCalls"), 0,
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_HeapVerify, W("HeapVerify"), 0, "When set verifies the integrity of the managed heap on entry and exit of each GC")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCNumaAware, W("GCNumaAware"), 1, "Specifies if to enable GC NUMA aware")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCCpuGroup, W("GCCpuGroup"), 0, "Specifies if to enable GC to support CPU groups")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCTransparentHugePages, W("GCTransparentHugePages"), 0, "Advises the OS to back GC heap reservations with transparent huge pages on Linux (madvise MADV_HUGEPAGE). Unlike GCLargePages this needs no preallocated huge page pool and does not commit the heap up front")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCTopologyAwarePlacement, W("GCTopologyAwarePlacement"), 1, "Maps GC heaps to primary SMT threads and performance cores before hyperthread siblings and efficiency cores on Linux")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCName, W("GCName"), "")
 
 ///
@@ -374,6 +377,8 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitMinNumCpus, W("MultiCoreJitMinNumC
 
 #endif
 
+RETAIL_CONFIG_STRING_INFO(INTERNAL_EagerTypeLoadList, W("EagerTypeLoadList"), "If set, file listing types (AssemblyName!Namespace.TypeName per line) to load on a background thread during startup.")
+
 #ifdef FEATURE_INTERPRETER
 ///
 /// Interpreter
@@ -526,6 +531,7 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ProfAPI_ValidateNGENInstrumentation, W("Pro
 #ifdef FEATURE_PERFMAP
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapEnabled, W("PerfMapEnabled"), 0, "This flag is used on Linux to enable writing /tmp/perf-$pid.map. It is disabled by default")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_PerfMapJitDumpPath, W("PerfMapJitDumpPath"), "Specifies a path to write the perf jitdump file. Defaults to GetTempPathA()")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapJitDumpLineInfo, W("PerfMapJitDumpLineInfo"), 0, "When the perf jitdump is enabled, also emit a line record per IL sequence point so perf inject --jit can annotate jitted code with IL offsets. It is disabled by default")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapIgnoreSignal, W("PerfMapIgnoreSignal"), 0, "When perf map is enabled, this option will configure the specified signal to be accepted and ignored as a marker in the perf logs.  It is disabled by default")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapShowOptimizationTiers, W("PerfMapShowOptimizationTiers"), 1, "Shows optimization tiers in the perf map for methods, as part of the symbol name. Useful for seeing separate stack frames for different optimization tiers of each method.")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_NativeImagePerfMapFormat, W("NativeImagePerfMapFormat"), "Specifies the format of native image perfmap files generated by crossgen.  Valid options are RVA or OFFSET.")
@@ -606,6 +612,8 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCountingDelayMs, W("TC_CallCountingDela
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DelaySingleProcMultiplier, W("TC_DelaySingleProcMultiplier"), 10, "Multiplier for TC_CallCountingDelayMs that is applied on a single-processor machine or when the process is affinitized to a single processor.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCounting, W("TC_CallCounting"), 1, "Enabled by default (only activates when TieredCompilation is also enabled). If disabled immediately backpatches prestub, and likely prevents any promotion to higher tiers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_UseCallCountingStubs, W("TC_UseCallCountingStubs"), 1, "Uses call counting stubs for faster call counting.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_SegregateHotCodeHeaps, W("TC_SegregateHotCodeHeaps"), 1, "Allocates tier-1 (optimized) method bodies on dedicated code heaps so hot code stays densely packed instead of interleaved with tier-0 bodies.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_PrioritizeRecentlyPromotedMethods, W("TC_PrioritizeRecentlyPromotedMethods"), 1, "Rejit the most recently promoted methods first instead of in promotion order, so methods that are hot now don't wait behind a warmup backlog.")
 #ifdef _DEBUG
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteCallCountingStubsAfter"), 1, "Deletes call counting stubs after this many have completed. Zero to disable deleting.")
 #else
@@ -656,6 +664,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_VirtualCallStubLogging, W("VirtualCallStubLogg
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubMissCount, W("VirtualCallStubMissCount"), 100, "Used only when STUB_LOGGING is defined, which by default is not.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubResetCacheCounter, W("VirtualCallStubResetCacheCounter"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
 CONFIG_DWORD_INFO(INTERNAL_VirtualCallStubResetCacheIncr, W("VirtualCallStubResetCacheIncr"), 0, "Used only when STUB_LOGGING is defined, which by default is not.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_VirtualCallStubRespecializeMonoPct, W("VirtualCallStubRespecializeMonoPct"), 25, "Percent chance that a resolve stub miss that finds an existing dispatch stub re-patches the call site back to it. 0 disables re-specialization.")
 
 ///
 /// Watson
@@ -741,6 +750,7 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_LTTng, W("LTTng"), 1, "If COMPlus_LTTng is
 // Executable code
 //
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableWriteXorExecute, W("EnableWriteXorExecute"), 0, "Enable W^X for executable memory.");
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_CodeHeapTransparentHugePages, W("CodeHeapTransparentHugePages"), 0, "Advises the OS to back code heap reservations with transparent huge pages on Linux (madvise MADV_HUGEPAGE).");
 
 #ifdef FEATURE_GDBJIT
 ///
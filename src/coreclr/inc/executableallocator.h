@@ -68,6 +68,9 @@ class ExecutableAllocator
     // Caches the COMPlus_EnableWXORX setting
     static bool g_isWXorXEnabled;
 
+    // Caches the COMPlus_CodeHeapTransparentHugePages setting
+    static bool g_isHugePagesHintEnabled;
+
     // Head of the linked list of all RX blocks that were allocated by this allocator
     BlockRX* m_pFirstBlockRX = NULL;
 
@@ -87,16 +90,21 @@ class ExecutableAllocator
     // for platforms that don't use shared memory.
     size_t m_freeOffset = 0;
 
-    // Last RW mapping cached so that it can be reused for the next mapping
-    // request if it goes into the same range.
-    BlockRW* m_cachedMapping = NULL;
+    // Recently used RW mappings are cached so that they can be reused for the next
+    // mapping request that goes into the same range. Each cache slot holds one
+    // reference on its block; a cached mapping is only unmapped when it is evicted
+    // and no other user has it mapped.
+    static const int CachedMappingCount = 8;
+    BlockRW* m_cachedMappings[CachedMappingCount] = {};
+    // Round robin victim index for the cache eviction
+    int m_cachedMappingVictim = 0;
 
     // Synchronization of the public allocator methods
     CRITSEC_COOKIE m_CriticalSection;
 
-    // Update currently cached mapping. If the passed in block is the same as the one
-    // in the cache, it keeps it cached. Otherwise it destroys the currently cached one
-    // and replaces it by the passed in one.
+    // Add the passed in block to the cache of recently used mappings. If the block
+    // is already cached, this is a no-op. Otherwise the least recently added entry
+    // is evicted and its mapping destroyed unless it is still in use elsewhere.
     void UpdateCachedMapping(BlockRW *pBlock);
 
     // Find existing RW block that maps the whole specified range of RX memory.
@@ -185,6 +193,12 @@ public:
     // executable code due to memory addressing performance related reasons.
     void* Commit(void* pStart, size_t size, bool isExecutable);
 
+    // Decommit the specified range of previously committed memory, returning the pages to
+    // the OS while keeping the address range reserved. Returns false when the pages cannot
+    // be decommitted; with double mapping enabled the committed pages are backed by a shared
+    // file and cannot be returned piecemeal, so the caller has to keep them.
+    bool Decommit(void* pStart, size_t size);
+
     // Release the executable memory block starting at the passed in address that was allocated
     // by one of the ReserveXXX methods.
     void Release(void* pRX);
@@ -43,11 +43,11 @@ typedef const GUID *LPCGUID;
 #define GUID_DEFINED
 #endif // !GUID_DEFINED
 
-constexpr GUID JITEEVersionIdentifier = { /* de9a9a0e-c66a-4d97-a268-92a31f99d919 */
-    0xde9a9a0e,
-    0xc66a,
-    0x4d97,
-    {0xa2, 0x68, 0x92, 0xa3, 0x1f, 0x99, 0xd9, 0x19}
+constexpr GUID JITEEVersionIdentifier = { /* 83df3d23-c39c-4690-9b46-2ef5bf02c40a */
+    0x83df3d23,
+    0xc39c,
+    0x4690,
+    {0x9b, 0x46, 0x2e, 0xf5, 0xbf, 0x02, 0xc4, 0x0a}
   };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,6 +418,14 @@ protected:
     void *UnlockedAllocMemForCode_NoThrow(size_t dwHeaderSize, size_t dwCodeSize, DWORD dwCodeAlignment, size_t dwReserveForJumpStubs);
 
     void UnlockedSetReservedRegion(BYTE* dwReservedRegionAddress, SIZE_T dwReservedRegionSize, BOOL fReleaseMemory);
+
+#ifndef DACCESS_COMPILE
+protected:
+    // Return committed-but-unused pages at the tail of the current block to the OS.
+    // The pages stay reserved and are recommitted on demand by the next allocation
+    // that needs them, so this is safe to call at any point between allocations.
+    void UnlockedTrim();
+#endif
 };
 
 //===============================================================================
@@ -727,6 +735,18 @@ public:
                            );
     }
 
+#ifndef DACCESS_COMPILE
+public:
+    // Return committed-but-unused pages at the tail of the heap to the OS. Useful for
+    // long-lived heaps after a burst of allocations that is not expected to repeat soon.
+    void Trim()
+    {
+        WRAPPER_NO_CONTRACT;
+        CRITSEC_Holder csh(m_CriticalSection);
+        UnlockedTrim();
+    }
+#endif
+
 public:
 // Extra CallTracing support
 #ifdef _DEBUG
@@ -98,7 +98,7 @@ struct SLink
 // fHead variable,
 //
 // if fHead is true, then the list allows only InsertHead  operations
-// if fHead is false, then the list allows only InsertTail operations
+// if fHead is false, then the list allows InsertTail (and InsertHead) operations
 // the code is optimized to perform these operations
 // all methods are inline, and conditional compiled based on template
 // argument 'fHead'
@@ -198,18 +198,21 @@ public:
     void InsertHead(T *pObj)
     {
         LIMITED_METHOD_CONTRACT;
-        // NOTE : conditional compilation on fHead template variable
-        if (fHead)
-        {
-            _ASSERTE(pObj != NULL);
-            SLink *pLink = GetLink(pObj);
+        _ASSERTE(pObj != NULL);
+        SLink *pLink = GetLink(pObj);
 
-            pLink->m_pNext = m_pHead->m_pNext;
-            m_pHead->m_pNext = pLink;
-        }
-        else
-        {// you instantiated this class asking only for InsertTail operations
-            _ASSERTE(0);
+        pLink->m_pNext = m_pHead->m_pNext;
+        m_pHead->m_pNext = pLink;
+
+        // conditionally compiled, if the instantiated class
+        // also uses InsertTail operations then the tail needs
+        // to be updated when inserting into an empty list
+        if (!fHead)
+        {
+            if (m_pTail == m_pHead)
+            {
+                m_pTail = pLink;
+            }
         }
     }
 
@@ -296,6 +296,15 @@ public:
     // This function is defined in the tools\strike\stressLogDump.cpp file
     static HRESULT Dump(ULONG64 logAddr, const char* fileName, struct IDebugDataSpaces* memCallBack);
 
+#if !defined(STRESS_LOG_READONLY) && !defined(STRESS_LOG_ANALYZER) && !defined(DACCESS_COMPILE)
+    // Serializes the live ring buffers into one contiguous blob, for the
+    // diagnostics server stress log command. Returns NULL if the log was
+    // never initialized or memory cannot be obtained; the caller releases
+    // the blob with FreeSnapshot. See SnapshotHeader for the layout.
+    static BYTE* CollectSnapshot(DWORD* pcbSnapshot);
+    static void FreeSnapshot(BYTE* pSnapshot);
+#endif //!STRESS_LOG_READONLY && !STRESS_LOG_ANALYZER && !DACCESS_COMPILE
+
     static BOOL StressLogOn(unsigned facility, unsigned level);
     static BOOL ETWLogOn(unsigned facility, unsigned level);
     static BOOL LogOn(unsigned facility, unsigned level);
@@ -322,6 +331,42 @@ public:
     static const size_t MAX_MODULES = 5;
     ModuleDesc    modules[MAX_MODULES];     // descriptor of the modules images
 
+    // Layout of the blob produced by CollectSnapshot. Everything is written in
+    // host endianness and the recorded addresses are the live addresses the
+    // data had, so embedded format string pointers resolve against the module
+    // descriptors exactly the way the analyzer resolves them for a dump.
+    struct SnapshotModule
+    {
+        uint64_t      baseAddress;
+        uint64_t      size;
+    };
+
+    struct SnapshotHeader
+    {
+        uint32_t      magic;                // must be 'SLSN'
+        uint32_t      version;              // must be 0x00010001
+        uint64_t      tickFrequency;        // number of ticks per second
+        uint64_t      startTimeStamp;       // start time from when tick counter started
+        uint64_t      moduleOffset;         // used to compute format strings
+        SnapshotModule modules[MAX_MODULES];
+        uint32_t      threadCount;          // number of SnapshotThread records that follow
+        uint32_t      padding;
+    };
+
+    struct SnapshotThread
+    {
+        uint64_t      threadId;             // the id of the thread that owned this ring
+        uint64_t      curPtr;               // live address of the most recently written message
+        uint32_t      isDead;
+        uint32_t      chunkCount;           // number of SnapshotChunk records that follow
+    };
+
+    struct SnapshotChunk
+    {
+        uint64_t      address;              // live address of the chunk payload
+        // STRESSLOG_CHUNK_SIZE raw bytes follow
+    };
+
 #if defined(HOST_WINDOWS) && defined(HOST_64BIT)
 #define MEMORY_MAPPED_STRESSLOG
 #endif
@@ -2590,6 +2590,14 @@ void CodeGen::genCodeForJumpTrue(GenTreeOp* jtrue)
     }
 
 #if defined(TARGET_XARCH)
+    if ((relop->gtFlags & GTF_RELOP_SJUMP_OPT) != 0)
+    {
+        // genCompareInt found the sign flag already set for this value and did not
+        // emit a compare, so consume SF directly instead of using jl/jge.
+        assert(relop->OperIs(GT_LT, GT_GE) && !relop->IsUnsigned());
+        condition = relop->OperIs(GT_LT) ? GenCondition(GenCondition::S) : GenCondition(GenCondition::NS);
+    }
+
     if ((condition.GetCode() == GenCondition::FNEU) &&
         (relop->gtGetOp1()->GetRegNum() == relop->gtGetOp2()->GetRegNum()) &&
         !relop->gtGetOp1()->isUsedFromSpillTemp() && !relop->gtGetOp2()->isUsedFromSpillTemp())
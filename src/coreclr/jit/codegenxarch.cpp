@@ -2795,12 +2795,20 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
     if (willUseSimdMov)
     {
         regNumber srcXmmReg = node->GetSingleTempReg(RBM_ALLFLOAT);
+        unsigned  regSize   = XMM_REGSIZE_BYTES;
 
         if (src->gtSkipReloadOrCopy()->IsIntegralConst(0))
         {
             // If the source is constant 0 then always use xorps, it's faster
             // than copying the constant from a GPR to a XMM register.
             emit->emitIns_R_R(INS_xorps, EA_16BYTE, srcXmmReg, srcXmmReg);
+
+            // The VEX encoding of xorps zeroes the entire register, so when AVX is
+            // available a zero fill can store 32 bytes at a time.
+            if ((size >= YMM_REGSIZE_BYTES) && compiler->compOpportunisticallyDependsOn(InstructionSet_AVX))
+            {
+                regSize = YMM_REGSIZE_BYTES;
+            }
         }
         else
         {
@@ -2813,7 +2821,6 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
         }
 
         instruction simdMov      = simdUnalignedMovIns();
-        unsigned    regSize      = XMM_REGSIZE_BYTES;
         unsigned    bytesWritten = 0;
 
         while (bytesWritten < size)
@@ -2827,6 +2834,13 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
 #endif
             if (bytesWritten + regSize > size)
             {
+                // Finish the tail of a 32 byte fill with a 16 byte store before falling
+                // back to GP stores.
+                if (regSize > XMM_REGSIZE_BYTES)
+                {
+                    regSize = XMM_REGSIZE_BYTES;
+                    continue;
+                }
                 assert(srcIntReg != REG_NA);
                 break;
             }
@@ -3016,9 +3030,22 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* node)
         regNumber tempReg = node->GetSingleTempReg(RBM_ALLFLOAT);
 
         instruction simdMov = simdUnalignedMovIns();
-        for (unsigned regSize = XMM_REGSIZE_BYTES; size >= regSize;
-             size -= regSize, srcOffset += regSize, dstOffset += regSize)
+
+        // Copy 32 bytes at a time when AVX is available - the VEX encoded unaligned
+        // moves halve the instruction count for larger blocks.
+        unsigned regSize = XMM_REGSIZE_BYTES;
+        if ((size >= YMM_REGSIZE_BYTES) && compiler->compOpportunisticallyDependsOn(InstructionSet_AVX))
+        {
+            regSize = YMM_REGSIZE_BYTES;
+        }
+
+        for (; size >= XMM_REGSIZE_BYTES; size -= regSize, srcOffset += regSize, dstOffset += regSize)
         {
+            while (regSize > size)
+            {
+                regSize /= 2;
+            }
+
             if (srcLclNum != BAD_VAR_NUM)
             {
                 emit->emitIns_R_S(simdMov, EA_ATTR(regSize), tempReg, srcLclNum, srcOffset);
@@ -6092,6 +6119,11 @@ void CodeGen::genCompareInt(GenTree* treeNode)
     {
         JITDUMP("Not emitting compare due to flags being already set\n");
     }
+    else if (canReuseFlags && emit->AreFlagsSetForSignJumpOpt(op1->GetRegNum(), emitTypeSize(type), tree))
+    {
+        JITDUMP("Not emitting compare due to sign being already set; the consuming jump will use js/jns\n");
+        tree->gtFlags |= GTF_RELOP_SJUMP_OPT;
+    }
     else
     {
         emit->emitInsBinary(ins, emitTypeSize(type), op1, op2);
@@ -1306,6 +1306,32 @@ void emitter::appendToCurIG(instrDesc* id)
     emitCurIGsize += id->idCodeSize();
 }
 
+//------------------------------------------------------------------------
+// emitRemoveLastInstruction: Remove the last instruction emitted, typically
+//    because a peephole is about to replace it. The instruction must still
+//    be in the current IG's buffer.
+//
+// Notes:
+//    We do not track the instruction before the last one, so emitLastIns is
+//    left null: subsequent peepholes will see no previous instruction until
+//    another one is emitted.
+//
+void emitter::emitRemoveLastInstruction()
+{
+    assert(emitLastIns != nullptr);
+    assert(emitCurIGinsCnt > 0);
+    assert(emitCurIGfreeBase <= (BYTE*)emitLastIns);
+    assert((BYTE*)emitLastIns < emitCurIGfreeNext);
+    assert(emitCurIGsize >= emitLastIns->idCodeSize());
+
+    emitCurIGfreeNext = (BYTE*)emitLastIns;
+    emitCurIGinsCnt--;
+    emitCurIGsize -= emitLastIns->idCodeSize();
+    emitInsCount--;
+
+    emitLastIns = nullptr;
+}
+
 /*****************************************************************************
  *
  *  Display (optionally) an instruction offset.
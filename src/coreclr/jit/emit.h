@@ -1897,6 +1897,8 @@ private:
 
     instrDesc* emitLastIns;
 
+    void emitRemoveLastInstruction();
+
 #ifdef DEBUG
     void emitCheckIGoffsets();
 #endif
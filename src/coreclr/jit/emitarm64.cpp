@@ -5625,6 +5625,13 @@ void emitter::emitIns_R_R_I(
         {
             return;
         }
+
+        // Or can it be combined with the previous ldr/str into a ldp/stp?
+        if (emitComp->opts.OptimizationEnabled() &&
+            ReplaceLdrStrWithPairInstr(ins, attr, reg1, reg2, imm, size, fmt))
+        {
+            return;
+        }
     }
     else if (isAddSub)
     {
@@ -15753,4 +15760,179 @@ bool emitter::IsRedundantLdStr(
 
     return false;
 }
+
+//-----------------------------------------------------------------------------------
+// IsOptimizableLdrStrWithPair: Check whether the current ldr/str and the
+//     previously emitted instruction access adjacent slots off the same base
+//     register and can be combined into a single ldp/stp.
+//
+// Examples:
+//     ldr w1, [x20, #4]
+//     ldr w2, [x20, #8]   =>  ldp w1, w2, [x20, #4]
+//
+//     str x1, [x20, #16]
+//     str x2, [x20, #8]   =>  stp x2, x1, [x20, #8]
+//
+// Arguments:
+//    ins  - The current instruction
+//    reg1 - The current source/destination register
+//    reg2 - The current base register
+//    imm  - Immediate offset (scaled for IF_LS_2B)
+//    size - Operand size
+//    fmt  - Format of instruction
+//
+// Return Value:
+//    eRO_ascending if the current offset is one slot above the previous one,
+//    eRO_descending if it is one slot below, eRO_none if the instructions
+//    cannot be combined.
+
+emitter::RegisterOrder emitter::IsOptimizableLdrStrWithPair(
+    instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt)
+{
+    if ((ins != INS_ldr) && (ins != INS_str))
+    {
+        return eRO_none;
+    }
+
+    // The previous instruction must still be in the current buffer since we are
+    // going to remove and re-emit it, and it must belong to this block. This also
+    // keeps prologs and epilogs intact, where the unwind info describes each
+    // instruction individually.
+    if ((emitLastIns == nullptr) || (emitCurIGinsCnt == 0) || emitIGisInProlog(emitCurIG) ||
+        emitIGisInEpilog(emitCurIG))
+    {
+        return eRO_none;
+    }
+
+    regNumber prevReg1   = emitLastIns->idReg1();
+    regNumber prevReg2   = emitLastIns->idReg2();
+    insFormat lastInsFmt = emitLastIns->idInsFmt();
+    emitAttr  prevSize   = emitLastIns->idOpSize();
+    ssize_t prevImm = emitLastIns->idIsLargeCns() ? ((instrDescCns*)emitLastIns)->idcCnsVal : emitLastIns->idSmallCns();
+
+    // Instruction and operand size must match the previous instruction.
+    if ((ins != emitLastIns->idIns()) || (prevSize != size))
+    {
+        return eRO_none;
+    }
+
+    // Both must use "base" or "base plus scaled immediate offset" addressing;
+    // the immediates of IF_LS_2C are unscaled and may be negative.
+    if (((fmt != IF_LS_2A) && (fmt != IF_LS_2B)) || ((lastInsFmt != IF_LS_2A) && (lastInsFmt != IF_LS_2B)))
+    {
+        return eRO_none;
+    }
+
+    // Only combine general register accesses. The lclVar forms carry stack slot
+    // GC liveness info that a combined descriptor could only track for one slot.
+    if (!isGeneralRegisterOrZR(reg1) || !isGeneralRegisterOrZR(prevReg1) || emitLastIns->idIsLclVar())
+    {
+        return eRO_none;
+    }
+
+    // The base registers must match. For loads, the first destination must not be
+    // the base register (the pair reads the base once, before either destination
+    // is written, so a clobbered base changes what the second load addresses) and
+    // the two destinations must differ (ldp with equal destinations is
+    // unpredictable).
+    if ((prevReg2 != reg2) || ((ins == INS_ldr) && ((prevReg1 == reg2) || (prevReg1 == reg1))))
+    {
+        return eRO_none;
+    }
+
+    // The offsets must address adjacent slots...
+    RegisterOrder order;
+    ssize_t       lowerImm;
+    if (imm == prevImm + 1)
+    {
+        order    = eRO_ascending;
+        lowerImm = prevImm;
+    }
+    else if (prevImm == imm + 1)
+    {
+        order    = eRO_descending;
+        lowerImm = imm;
+    }
+    else
+    {
+        return eRO_none;
+    }
+
+    // ...and the lower one must fit in the scaled 7-bit signed immediate of ldp/stp.
+    if (lowerImm > 63)
+    {
+        return eRO_none;
+    }
+
+    return order;
+}
+
+//-----------------------------------------------------------------------------------
+// ReplaceLdrStrWithPairInstr: If the current ldr/str can be combined with the
+//     previous one, remove the previous instruction and emit an equivalent
+//     ldp/stp instead.
+//
+// Arguments:
+//    ins      - The current instruction
+//    reg1Attr - The reg1 attribute of the current instruction
+//    reg1     - The current source/destination register
+//    reg2     - The current base register
+//    imm      - Immediate offset (scaled for IF_LS_2B)
+//    size     - Operand size
+//    fmt      - Format of instruction
+//
+// Return Value:
+//    true if the pair instruction was emitted in place of the two single
+//    accesses, in which case the caller has nothing left to emit.
+
+bool emitter::ReplaceLdrStrWithPairInstr(
+    instruction ins, emitAttr reg1Attr, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt)
+{
+    RegisterOrder order = IsOptimizableLdrStrWithPair(ins, reg1, reg2, imm, size, fmt);
+
+    if (order == eRO_none)
+    {
+        return false;
+    }
+
+    regNumber prevReg1 = emitLastIns->idReg1();
+    ssize_t prevImm = emitLastIns->idIsLargeCns() ? ((instrDescCns*)emitLastIns)->idcCnsVal : emitLastIns->idSmallCns();
+
+    // Capture the GC-ness of the previous destination/source register before the
+    // instruction is removed.
+    emitAttr prevReg1Attr;
+    switch (emitLastIns->idGCref())
+    {
+        case GCT_GCREF:
+            prevReg1Attr = EA_GCREF;
+            break;
+        case GCT_BYREF:
+            prevReg1Attr = EA_BYREF;
+            break;
+        default:
+            prevReg1Attr = emitLastIns->idOpSize();
+            break;
+    }
+
+    emitRemoveLastInstruction();
+
+    const instruction pairIns = (ins == INS_ldr) ? INS_ldp : INS_stp;
+    const unsigned    scale   = (size == EA_8BYTE) ? 3 : 2;
+
+    // The stored immediates are in scaled units; emitIns_R_R_R_I expects bytes.
+    // The base register was encoded SP-to-ZR when the previous instruction was
+    // created, so undo that before re-emitting.
+    if (order == eRO_ascending)
+    {
+        emitIns_R_R_R_I(pairIns, prevReg1Attr, prevReg1, reg1, encodingZRtoSP(reg2), prevImm << scale, INS_OPTS_NONE,
+                        reg1Attr);
+    }
+    else
+    {
+        emitIns_R_R_R_I(pairIns, reg1Attr, reg1, prevReg1, encodingZRtoSP(reg2), imm << scale, INS_OPTS_NONE,
+                        prevReg1Attr);
+    }
+
+    return true;
+}
 #endif // defined(TARGET_ARM64)
@@ -121,6 +121,22 @@ static bool IsMovInstruction(instruction ins);
 bool IsRedundantMov(instruction ins, emitAttr size, regNumber dst, regNumber src, bool canSkip);
 bool IsRedundantLdStr(instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
 
+// Relative ordering of the destination/source registers of two successive
+// ldr/str instructions that can be combined into a single ldp/stp.
+enum RegisterOrder
+{
+    eRO_none = 0,
+    eRO_ascending,
+    eRO_descending,
+};
+
+// Methods to check and perform the combining of two successive ldr/str
+// instructions into a single ldp/stp instruction.
+RegisterOrder IsOptimizableLdrStrWithPair(
+    instruction ins, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
+bool ReplaceLdrStrWithPairInstr(
+    instruction ins, emitAttr reg1Attr, regNumber reg1, regNumber reg2, ssize_t imm, emitAttr size, insFormat fmt);
+
 /************************************************************************
 *
 * This union is used to to encode/decode the special ARM64 immediate values
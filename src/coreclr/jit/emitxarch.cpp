@@ -164,6 +164,21 @@ bool emitter::DoesWriteZeroFlag(instruction ins)
     return (CodeGenInterface::instInfo[ins] & Writes_ZF) != 0;
 }
 
+//------------------------------------------------------------------------
+// DoesWriteSignFlag: check if the instruction writes the
+//     SF flag.
+//
+// Arguments:
+//    ins - instruction to test
+//
+// Return Value:
+//    true if instruction writes the SF flag, false otherwise.
+//
+bool emitter::DoesWriteSignFlag(instruction ins)
+{
+    return (CodeGenInterface::instInfo[ins] & Writes_SF) != 0;
+}
+
 //------------------------------------------------------------------------
 // DoesResetOverflowAndCarryFlags: check if the instruction resets the
 //     OF and CF flag to 0.
@@ -393,6 +408,77 @@ bool emitter::AreFlagsSetToZeroCmp(regNumber reg, emitAttr opSize, genTreeOps tr
     return false;
 }
 
+//------------------------------------------------------------------------
+// AreFlagsSetForSignJumpOpt: checks if the previous instruction set the SF so that a
+//                            signed compare of reg against 0 can be replaced by a
+//                            js/jns (or sets/setns) on the existing flags
+//
+// Arguments:
+//    reg    - register of interest
+//    opSize - size of register
+//    tree   - the relop being generated; must be a signed GT_LT or GT_GE against 0
+//
+// Return Value:
+//    true if the flags can be reused
+//    false if not, or if we can't safely determine
+//
+// Notes:
+//    Currently only looks back one instruction. Only the sign flag is consumed
+//    (js/jns), so unlike jl/jge the state of OF does not matter.
+bool emitter::AreFlagsSetForSignJumpOpt(regNumber reg, emitAttr opSize, GenTree* tree)
+{
+    assert(reg != REG_NA);
+
+    // Don't look back across IG boundaries (possible control flow)
+    if (emitCurIGinsCnt == 0 && ((emitCurIG->igFlags & IGF_EXTEND) == 0))
+    {
+        return false;
+    }
+
+    instrDesc*  id      = emitLastIns;
+    instruction lastIns = id->idIns();
+    insFormat   fmt     = id->idInsFmt();
+
+    // make sure op1 is a reg
+    switch (fmt)
+    {
+        case IF_RWR_CNS:
+        case IF_RRW_CNS:
+        case IF_RRW_SHF:
+        case IF_RWR_RRD:
+        case IF_RRW_RRD:
+        case IF_RWR_MRD:
+        case IF_RWR_SRD:
+        case IF_RRW_SRD:
+        case IF_RWR_ARD:
+        case IF_RRW_ARD:
+        case IF_RWR:
+        case IF_RRD:
+        case IF_RRW:
+            break;
+        default:
+            return false;
+    }
+
+    if (id->idReg1() != reg)
+    {
+        return false;
+    }
+
+    // If we have a GT_GE/GT_LT which generates an jge/jl jump condition,
+    // check if we can eliminate the "test" by reusing the sign flag from
+    // an earlier instruction that wrote it for this value.
+    if (tree->OperIs(GT_GE, GT_LT) && !tree->IsUnsigned())
+    {
+        if (DoesWriteSignFlag(lastIns) && IsFlagsAlwaysModified(id))
+        {
+            return id->idOpSize() == opSize;
+        }
+    }
+
+    return false;
+}
+
 //------------------------------------------------------------------------
 // IsDstSrcImmAvxInstruction: Checks if the instruction has a "reg, reg/mem, imm" or
 //                            "reg/mem, reg, imm" form for the legacy, VEX, and EVEX
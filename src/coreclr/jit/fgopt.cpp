@@ -3535,6 +3535,17 @@ bool Compiler::fgOptimizeBranch(BasicBlock* bJump)
         }
     }
 
+    //
+    // If profile data shows bJump is the dominant predecessor of the condition,
+    // duplicating along this edge removes a re-test on the hot path, so allow
+    // more code growth. Merge blocks in dispatch-style loops commonly have one
+    // heavily skewed incoming edge.
+    //
+    if (allProfileWeightsAreValid && !rareJump && ((weightJump * 2) >= weightDest))
+    {
+        maxDupCostSz *= 2;
+    }
+
     // If the compare has too high cost then we don't want to dup
 
     bool costIsTooHigh = (estDupCostSz > maxDupCostSz);
@@ -4028,6 +4039,24 @@ bool Compiler::fgExpandRarelyRunBlocks()
                 }
                 break;
 
+            case BBJ_SWITCH:
+            {
+                bool allTargetsRare = true;
+                for (BasicBlock* const bTarget : bPrev->SwitchTargets())
+                {
+                    if (!bTarget->isRunRarely())
+                    {
+                        allTargetsRare = false;
+                        break;
+                    }
+                }
+                if (allTargetsRare)
+                {
+                    reason = "All switch targets are rarely run";
+                }
+            }
+            break;
+
             default:
                 break;
         }
@@ -4231,9 +4260,6 @@ bool Compiler::fgReorderBlocks()
     //
     if (fgIsUsingProfileWeights())
     {
-        //
-        // Note that this is currently not yet implemented
-        //
         optimizedSwitches = fgOptimizeSwitchJumps();
         if (optimizedSwitches)
         {
@@ -383,6 +383,23 @@ void BlockCountInstrumentor::Instrument(BasicBlock* block, Schema& schema, BYTE*
 
     var_types typ =
         entry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::BasicBlockIntCount ? TYP_INT : TYP_LONG;
+
+    if ((JitConfig.JitScalableProfileCounters() != 0) && !m_comp->opts.jitFlags->IsSet(JitFlags::JIT_FLAG_PREJIT))
+    {
+        // Let the runtime helper update the count; it backs off to probabilistic
+        // updates for hot counters to avoid cache contention.
+        GenTree* const addressNode = m_comp->gtNewIconHandleNode(addrOfCurrentExecutionCount, GTF_ICON_BBC_PTR);
+        GenTreeCall::Use* const args = m_comp->gtNewCallArgs(addressNode);
+        GenTree* const          callNode =
+            m_comp->gtNewHelperCallNode(typ == TYP_INT ? CORINFO_HELP_COUNTPROFILE32 : CORINFO_HELP_COUNTPROFILE64,
+                                        TYP_VOID, args);
+
+        m_comp->fgNewStmtAtBeg(block, callNode);
+
+        m_instrCount++;
+        return;
+    }
+
     // Read Basic-Block count value
     GenTree* valueNode = m_comp->gtNewIndOfIconHandleNode(typ, addrOfCurrentExecutionCount, GTF_ICON_BBC_PTR, false);
 
@@ -1148,6 +1165,23 @@ void EfficientEdgeCountInstrumentor::Instrument(BasicBlock* block, Schema& schem
 
         var_types typ =
             entry.InstrumentationKind == ICorJitInfo::PgoInstrumentationKind::EdgeIntCount ? TYP_INT : TYP_LONG;
+
+        if ((JitConfig.JitScalableProfileCounters() != 0) && !m_comp->opts.jitFlags->IsSet(JitFlags::JIT_FLAG_PREJIT))
+        {
+            // Let the runtime helper update the count; it backs off to probabilistic
+            // updates for hot counters to avoid cache contention.
+            GenTree* const addressNode = m_comp->gtNewIconHandleNode(addrOfCurrentExecutionCount, GTF_ICON_BBC_PTR);
+            GenTreeCall::Use* const args = m_comp->gtNewCallArgs(addressNode);
+            GenTree* const          callNode =
+                m_comp->gtNewHelperCallNode(typ == TYP_INT ? CORINFO_HELP_COUNTPROFILE32 : CORINFO_HELP_COUNTPROFILE64,
+                                            TYP_VOID, args);
+
+            m_comp->fgNewStmtAtBeg(instrumentedBlock, callNode);
+
+            m_instrCount++;
+            continue;
+        }
+
         // Read Basic-Block count value
         GenTree* valueNode =
             m_comp->gtNewIndOfIconHandleNode(typ, addrOfCurrentExecutionCount, GTF_ICON_BBC_PTR, false);
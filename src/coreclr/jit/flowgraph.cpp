@@ -72,7 +72,15 @@ PhaseStatus Compiler::fgInsertGCPolls()
 {
     PhaseStatus result = PhaseStatus::MODIFIED_NOTHING;
 
-    if ((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0)
+    // Optionally poll the back edges of loops that contain no GC safe points. A thread
+    // executing such a loop in cooperative mode can only be brought to a safe point by
+    // return-address hijacking, so suspension has to wait for the loop to exit; an
+    // explicit poll on the back edge makes time-to-suspend proportional to a single
+    // iteration instead.
+    const bool pollLoopBackEdges =
+        (JitConfig.JitGCPollLoops() != 0) && opts.OptimizationEnabled() && fgHasLoops;
+
+    if (((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0) && !pollLoopBackEdges)
     {
         return result;
     }
@@ -95,7 +103,31 @@ PhaseStatus Compiler::fgInsertGCPolls()
     {
         // When optimizations are enabled, we can't rely on BBF_HAS_SUPPRESSGC_CALL flag:
         // the call could've been moved, e.g., hoisted from a loop, CSE'd, etc.
-        if (opts.OptimizationDisabled() ? ((block->bbFlags & BBF_HAS_SUPPRESSGC_CALL) == 0) : !blockNeedsGCPoll(block))
+        bool blockNeedsPoll = ((optMethodFlags & OMF_NEEDS_GCPOLLS) != 0) &&
+                              (opts.OptimizationDisabled() ? ((block->bbFlags & BBF_HAS_SUPPRESSGC_CALL) != 0)
+                                                           : blockNeedsGCPoll(block));
+
+        if (!blockNeedsPoll && pollLoopBackEdges &&
+            ((block->bbJumpKind == BBJ_COND) || (block->bbJumpKind == BBJ_ALWAYS)) &&
+            (block->bbJumpDest->bbNum <= block->bbNum))
+        {
+            // This block closes a lexical loop. If no block in the loop body is a GC
+            // safe point then nothing inside the loop can observe a pending
+            // suspension, so poll here.
+            bool loopHasSafePoint = false;
+            for (BasicBlock* loopBlock = block->bbJumpDest; loopBlock != block->bbNext; loopBlock = loopBlock->bbNext)
+            {
+                if ((loopBlock->bbFlags & BBF_GC_SAFE_POINT) != 0)
+                {
+                    loopHasSafePoint = true;
+                    break;
+                }
+            }
+
+            blockNeedsPoll = !loopHasSafePoint;
+        }
+
+        if (!blockNeedsPoll)
         {
             continue;
         }
@@ -0,0 +1,383 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "jitpch.h"
+
+#ifdef _MSC_VER
+#pragma hdrstop
+#endif
+
+// Simple Forward Substitution
+//
+// This phase tries to reconnect trees that were split early on by
+// phases like the importer and inlining. We run it before morph
+// to provide more context for morph's tree based optimizations, and
+// to reduce the number of temp-to-temp copies in temp-heavy (often
+// generated) code.
+//
+// The general pattern we look for is
+//
+//  Statement(n):
+//    ASG(lcl, tree)
+//  Statement(n+1):
+//    ... use of lcl ...
+//
+// where the local has exactly one def and one use, is not aliased, and
+// the tree can be moved into the use without changing observable
+// behavior. When all the checks pass, the use is replaced by the tree
+// and statement (n) is removed.
+//
+// The ref count screening relies on the early (RCS_EARLY) counts that
+// the LocalAddressVisitor computes for all locals when optimizing.
+
+//------------------------------------------------------------------------
+// fgForwardSub: try forward substitution in this method
+//
+// Returns:
+//   suitable phase status
+//
+PhaseStatus Compiler::fgForwardSub()
+{
+    if (!opts.OptimizationEnabled())
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+
+#if defined(DEBUG)
+    if (JitConfig.JitNoForwardSub() > 0)
+    {
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
+#endif
+
+    bool changed = false;
+
+    for (BasicBlock* const block : Blocks())
+    {
+        JITDUMP("\n\n===> " FMT_BB "\n", block->bbNum);
+        changed |= fgForwardSubBlock(block);
+    }
+
+    return changed ? PhaseStatus::MODIFIED_EVERYTHING : PhaseStatus::MODIFIED_NOTHING;
+}
+
+//------------------------------------------------------------------------
+// fgForwardSubBlock: try forward substitution in this block
+//
+// Arguments:
+//    block -- block to process
+//
+// Returns:
+//    true if any statement was forward substituted
+//
+bool Compiler::fgForwardSubBlock(BasicBlock* block)
+{
+    Statement* stmt     = block->firstStmt();
+    Statement* lastStmt = block->lastStmt();
+    bool       changed  = false;
+
+    while (stmt != lastStmt)
+    {
+        Statement* const nextStmt    = stmt->GetNextStmt();
+        bool const       substituted = fgForwardSubStatement(stmt);
+
+        if (substituted)
+        {
+            fgRemoveStmt(block, stmt);
+            changed = true;
+        }
+
+        stmt = nextStmt;
+    }
+
+    return changed;
+}
+
+//------------------------------------------------------------------------
+// ForwardSubVisitor: tree visitor to locate uses of a local in a tree
+//
+// Also computes the set of side effects that happen "before" the use,
+// in execution order, which limits what can legally be substituted.
+//
+class ForwardSubVisitor final : public GenTreeVisitor<ForwardSubVisitor>
+{
+public:
+    enum
+    {
+        DoPostOrder       = true,
+        UseExecutionOrder = true
+    };
+
+    ForwardSubVisitor(Compiler* compiler, unsigned lclNum)
+        : GenTreeVisitor<ForwardSubVisitor>(compiler)
+        , m_use(nullptr)
+        , m_node(nullptr)
+        , m_parentNode(nullptr)
+        , m_lclNum(lclNum)
+        , m_useCount(0)
+        , m_useFlags(GTF_EMPTY)
+        , m_accumulatedFlags(GTF_EMPTY)
+    {
+    }
+
+    Compiler::fgWalkResult PostOrderVisit(GenTree** use, GenTree* user)
+    {
+        GenTree* const node = *use;
+
+        if (node->OperIs(GT_LCL_VAR))
+        {
+            unsigned const lclNum = node->AsLclVarCommon()->GetLclNum();
+
+            if (lclNum == m_lclNum)
+            {
+                m_useCount++;
+
+                // Screen out contextual "uses"
+                //
+                bool const isDef  = ((node->gtFlags & GTF_VAR_DEF) != 0);
+                bool const isAddr = (user != nullptr) && user->OperIs(GT_ADDR);
+
+                // Also screen out the target of an indirect call;
+                // fgGetStubAddrArg cannot handle complex trees.
+                //
+                bool isCallTarget = false;
+                if ((user != nullptr) && user->IsCall())
+                {
+                    GenTreeCall* const call = user->AsCall();
+                    isCallTarget            = (call->gtCallType == CT_INDIRECT) && (call->gtCallAddr == node);
+                }
+
+                if (!isDef && !isAddr && !isCallTarget)
+                {
+                    m_node       = node;
+                    m_use        = use;
+                    m_useFlags   = m_accumulatedFlags;
+                    m_parentNode = user;
+                }
+            }
+        }
+
+        m_accumulatedFlags |= (node->gtFlags & GTF_GLOB_EFFECT);
+
+        return Compiler::WALK_CONTINUE;
+    }
+
+    unsigned GetUseCount() const
+    {
+        return m_useCount;
+    }
+
+    GenTree* GetNode() const
+    {
+        return m_node;
+    }
+
+    GenTree** GetUse() const
+    {
+        return m_use;
+    }
+
+    GenTree* GetParentNode() const
+    {
+        return m_parentNode;
+    }
+
+    GenTreeFlags GetFlags() const
+    {
+        return m_useFlags;
+    }
+
+private:
+    GenTree**    m_use;
+    GenTree*     m_node;
+    GenTree*     m_parentNode;
+    unsigned     m_lclNum;
+    unsigned     m_useCount;
+    GenTreeFlags m_useFlags;
+    GenTreeFlags m_accumulatedFlags;
+};
+
+//------------------------------------------------------------------------
+// fgForwardSubStatement: forward substitute this statement's
+//  computation to the next statement, if legal and profitable
+//
+// Arguments:
+//    stmt - statement in question
+//
+// Returns:
+//    true if statement computation was forwarded
+//
+bool Compiler::fgForwardSubStatement(Statement* stmt)
+{
+    // Is this tree a def of a single use, unaliased local?
+    //
+    GenTree* const rootNode = stmt->GetRootNode();
+
+    if (!rootNode->OperIs(GT_ASG))
+    {
+        return false;
+    }
+
+    GenTree* const lhsNode = rootNode->gtGetOp1();
+
+    if (!lhsNode->OperIs(GT_LCL_VAR))
+    {
+        return false;
+    }
+
+    // The def must write the entire local.
+    //
+    if ((lhsNode->gtFlags & GTF_VAR_USEASG) != 0)
+    {
+        return false;
+    }
+
+    JITDUMP("    [%06u]: ", dspTreeID(rootNode));
+
+    unsigned const   lclNum = lhsNode->AsLclVarCommon()->GetLclNum();
+    LclVarDsc* const varDsc = lvaGetDesc(lclNum);
+
+    // Only fwd sub if we expect no code duplication.
+    // We expect one def and one use.
+    //
+    if (varDsc->lvRefCnt(RCS_EARLY) != 2)
+    {
+        JITDUMP(" not single-use lcl\n");
+        return false;
+    }
+
+    // And only if the local is unaliased.
+    //
+    if (varDsc->lvAddrExposed)
+    {
+        JITDUMP(" not unaliased lcl\n");
+        return false;
+    }
+
+    // A pinned local can't be replaced by its value.
+    //
+    if (varDsc->lvPinned)
+    {
+        JITDUMP(" pinned lcl\n");
+        return false;
+    }
+
+    // Promoted locals and their fields have entangled ref counts,
+    // and implicit byrefs use the early counts for the copy omission
+    // and promotion undo heuristics; leave all of those alone.
+    //
+    if (varDsc->lvPromoted || varDsc->lvIsStructField || lvaIsImplicitByRefLocal(lclNum))
+    {
+        JITDUMP(" promoted/field/implicit-byref lcl\n");
+        return false;
+    }
+
+    // Check the tree we're substituting.
+    //
+    // A qmark would need to stay a statement root; a catch arg is only
+    // valid at the start of a handler; a lclheap must not migrate past
+    // other trees.
+    //
+    GenTree* const fwdSubNode = rootNode->gtGetOp2();
+
+    if (fwdSubNode->OperIs(GT_QMARK, GT_CATCH_ARG, GT_LCLHEAP))
+    {
+        JITDUMP(" tree to sub is qmark/catch-arg/lclheap\n");
+        return false;
+    }
+
+    // An embedded assignment in the tree could interfere with local
+    // reads evaluated earlier in the next statement; those reads carry
+    // no flags we could check against, so don't substitute at all.
+    //
+    if ((fwdSubNode->gtFlags & GTF_ASG) != 0)
+    {
+        JITDUMP(" tree to sub has embedded assignment\n");
+        return false;
+    }
+
+    // Local and tree to substitute seem suitable.
+    // See if the next statement contains the one and only use.
+    //
+    Statement* const nextStmt = stmt->GetNextStmt();
+
+    // We often see stale flags, eg call flags after inlining.
+    // Try and clean these up.
+    //
+    gtUpdateStmtSideEffects(stmt);
+    gtUpdateStmtSideEffects(nextStmt);
+
+    // Scan for the (single) use.
+    //
+    ForwardSubVisitor fsv(this, lclNum);
+    fsv.WalkTree(nextStmt->GetRootNodePointer(), nullptr);
+
+    // The LocalAddressVisitor counts said there was just one use.
+    // It had better be in the next statement, and not contextual.
+    //
+    if ((fsv.GetUseCount() != 1) || (fsv.GetNode() == nullptr))
+    {
+        JITDUMP(" no next stmt use\n");
+        return false;
+    }
+
+    // Bail if types disagree; the assignment may imply a conversion
+    // (say a small-typed store normalizing on load) that substitution
+    // would lose.
+    //
+    if ((fwdSubNode->TypeGet() != fsv.GetNode()->TypeGet()) || varTypeIsSmall(fsv.GetNode()->TypeGet()))
+    {
+        JITDUMP(" mismatched or small types\n");
+        return false;
+    }
+
+    // For struct values the layouts must agree as well, and the tree
+    // must be a form that morph's struct codegen paths know how to
+    // handle in an arbitrary context (in particular as a call arg).
+    //
+    if (fwdSubNode->TypeGet() == TYP_STRUCT)
+    {
+        if (!fwdSubNode->OperIs(GT_LCL_VAR, GT_LCL_FLD, GT_OBJ))
+        {
+            JITDUMP(" sub tree is an unsupported struct form\n");
+            return false;
+        }
+
+        CORINFO_CLASS_HANDLE const fwdHnd = gtGetStructHandleIfPresent(fwdSubNode);
+        CORINFO_CLASS_HANDLE const useHnd = gtGetStructHandleIfPresent(fsv.GetNode());
+
+        if ((fwdHnd == NO_CLASS_HANDLE) || (fwdHnd != useHnd))
+        {
+            JITDUMP(" mismatched struct handles\n");
+            return false;
+        }
+    }
+
+    // See if we can forward sub without changing semantics.
+    //
+    // The substituted tree moves from the end of this statement to the
+    // middle of the next one, past everything the next statement
+    // evaluates before the use. If any of that work writes anything
+    // (locals included), makes a call, reads global state, or can
+    // throw, reordering is not safe in general: the preceding work
+    // could alter what the tree computes, or the tree's own effects
+    // (if any) could become visible too late.
+    //
+    if ((fsv.GetFlags() & (GTF_EXCEPT | GTF_GLOB_REF | GTF_CALL | GTF_ASG)) != 0)
+    {
+        JITDUMP(" next stmt has effects before use\n");
+        return false;
+    }
+
+    // Looks good, forward sub!
+    //
+    GenTree** const use = fsv.GetUse();
+    *use                = fwdSubNode;
+
+    gtUpdateStmtSideEffects(nextStmt);
+
+    JITDUMP(" -- fwd subbing [%06u]; new next stmt is\n", dspTreeID(fwdSubNode));
+    DISPSTMT(nextStmt);
+
+    return true;
+}
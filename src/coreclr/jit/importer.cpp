@@ -2315,6 +2315,12 @@ GenTree* Compiler::impRuntimeLookupToTree(CORINFO_RESOLVED_TOKEN* pResolvedToken
 
         if (!pRuntimeLookup->testForFixup)
         {
+            // When the runtime requires neither a null test nor a fixup test the
+            // dictionary slot is guaranteed to be published already and is immutable
+            // from then on, so the final load is invariant too. This gives it a
+            // read-only heap value number, letting CSE and hoisting commonize
+            // repeated lookups of the same slot.
+            slotPtrTree->gtFlags |= GTF_IND_INVARIANT;
             return slotPtrTree;
         }
 
@@ -21651,9 +21657,14 @@ void Compiler::considerGuardedDevirtualization(
 
     // See if there's a likely guess for the class.
     //
-    const unsigned likelihoodThreshold = isInterface ? 25 : 30;
-    unsigned       likelihood          = 0;
-    unsigned       numberOfClasses     = 0;
+    unsigned  likelihoodThreshold = isInterface ? 25 : 30;
+    const int configThreshold     = JitConfig.JitGuardedDevirtualizationLikelihoodThreshold();
+    if ((configThreshold >= 0) && (configThreshold <= 100))
+    {
+        likelihoodThreshold = (unsigned)configThreshold;
+    }
+    unsigned likelihood      = 0;
+    unsigned numberOfClasses = 0;
 
     CORINFO_CLASS_HANDLE likelyClass = NO_CLASS_HANDLE;
 
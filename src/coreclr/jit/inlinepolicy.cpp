@@ -1394,6 +1394,59 @@ void ExtendedDefaultPolicy::NoteDouble(InlineObservation obs, double value)
     m_ProfileFrequency = value;
 }
 
+//------------------------------------------------------------------------
+// BudgetCheck: see if this inline would exceed the current budget
+//
+// Returns:
+//   True if inline would exceed the budget.
+//
+// Notes:
+//   Like the DefaultPolicy check, but hot callsites backed by a
+//   trusted (dynamic) profile get the same over-budget latitude as
+//   top-level forceinlines. By the time the budget runs low the cheap
+//   early inlines are already done, and a demonstrably hot callsite
+//   is where the remaining budget is best spent.
+
+bool ExtendedDefaultPolicy::BudgetCheck() const
+{
+    // Only relevant if we're actually inlining.
+    //
+    if (m_IsPrejitRoot)
+    {
+        return false;
+    }
+
+    InlineStrategy* strategy   = m_RootCompiler->m_inlineStrategy;
+    const bool      overBudget = strategy->BudgetCheck(m_CodeSize);
+
+    if (overBudget)
+    {
+        assert(m_IsForceInlineKnown);
+        assert(m_CallsiteDepth > 0);
+
+        bool allowOverBudget = m_IsForceInline && (m_CallsiteDepth == 1);
+
+        if (allowOverBudget)
+        {
+            JITDUMP("Allowing over-budget top-level forceinline\n");
+        }
+        else if (m_HasProfile && (m_CallsiteDepth == 1) &&
+                 (m_RootCompiler->fgPgoSource == ICorJitInfo::PgoSource::Dynamic) &&
+                 (m_ProfileFrequency >= (double)JitConfig.JitExtDefaultPolicyProfBudgetFreq() / 100.0))
+        {
+            allowOverBudget = true;
+            JITDUMP("Allowing over-budget inline at hot profiled callsite (frequency %g)\n", m_ProfileFrequency);
+        }
+
+        if (!allowOverBudget)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 //------------------------------------------------------------------------
 // DetermineMultiplier: determine benefit multiplier for this inline
 //
@@ -220,6 +220,8 @@ public:
 
     double DetermineMultiplier() override;
 
+    bool BudgetCheck() const override;
+
     bool RequiresPreciseScan() override
     {
         return true;
@@ -111,6 +111,9 @@ CONFIG_INTEGER(JitMinOptsLvNumCount, W("JITMinOptsLvNumcount"), DEFAULT_MIN_OPTS
                                                                                                // of MinOpts
 CONFIG_INTEGER(JitMinOptsLvRefCount, W("JITMinOptsLvRefcount"), DEFAULT_MIN_OPTS_LV_REF_COUNT) // Internal jit control
                                                                                                // of MinOpts
+CONFIG_INTEGER(JitGCPollLoops, W("JitGCPollLoops"), 0) // If 1, insert GC polls on the back edges of loops that
+                                                       // contain no GC safe points, bounding suspension latency
+                                                       // for threads spinning in such loops
 CONFIG_INTEGER(JitNoCMOV, W("JitNoCMOV"), 0)
 CONFIG_INTEGER(JitNoCSE, W("JitNoCSE"), 0)
 CONFIG_INTEGER(JitNoCSE2, W("JitNoCSE2"), 0)
@@ -123,6 +126,7 @@ CONFIG_INTEGER(JitNoMemoryBarriers, W("JitNoMemoryBarriers"), 0) // If 1, don't
 CONFIG_INTEGER(JitNoRegLoc, W("JitNoRegLoc"), 0)
 CONFIG_INTEGER(JitNoStructPromotion, W("JitNoStructPromotion"), 0) // Disables struct promotion 1 - for all, 2 - for
                                                                    // params.
+CONFIG_INTEGER(JitNoForwardSub, W("JitNoForwardSub"), 0) // Disables forward substitution
 CONFIG_INTEGER(JitNoUnroll, W("JitNoUnroll"), 0)
 CONFIG_INTEGER(JitOrder, W("JitOrder"), 0)
 CONFIG_INTEGER(JitQueryCurrentStaticFieldClass, W("JitQueryCurrentStaticFieldClass"), 1)
@@ -389,6 +393,11 @@ CONFIG_INTEGER(JitInlineSIMDMultiplier, W("JitInlineSIMDMultiplier"), 3)
 // Ex lclMAX_TRACKED constant.
 CONFIG_INTEGER(JitMaxLocalsToTrack, W("JitMaxLocalsToTrack"), 0x400)
 
+// If 1, run block-local assertion prop during morph even when we are not optimizing
+// (e.g. at Tier-0), to trim redundant null checks and casts. Has no effect on
+// debuggable code, where propagation stays disabled.
+CONFIG_INTEGER(JitEnableTier0LocalAssertionProp, W("JitEnableTier0LocalAssertionProp"), 1)
+
 #if defined(FEATURE_ENABLE_NO_RANGE_CHECKS)
 CONFIG_INTEGER(JitNoRngChks, W("JitNoRngChks"), 0) // If 1, don't generate range checks
 #endif                                             // defined(FEATURE_ENABLE_NO_RANGE_CHECKS)
@@ -477,6 +486,10 @@ CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, W("JitExtDefaultPolicyMaxBB"), 7)
 CONFIG_INTEGER(JitExtDefaultPolicyProfTrust, W("JitExtDefaultPolicyProfTrust"), 0x7)
 CONFIG_INTEGER(JitExtDefaultPolicyProfScale, W("JitExtDefaultPolicyProfScale"), 0x2A)
 
+// Minimum callsite profile frequency (in hundredths, relative to the method entry weight) for a
+// top-level inline backed by dynamic PGO to proceed once the time budget is exhausted.
+CONFIG_INTEGER(JitExtDefaultPolicyProfBudgetFreq, W("JitExtDefaultPolicyProfBudgetFreq"), 0x4B) // 0.75
+
 CONFIG_INTEGER(JitInlinePolicyModel, W("JitInlinePolicyModel"), 0)
 CONFIG_INTEGER(JitInlinePolicyProfile, W("JitInlinePolicyProfile"), 0)
 CONFIG_INTEGER(JitInlinePolicyProfileThreshold, W("JitInlinePolicyProfileThreshold"), 40)
@@ -495,6 +508,9 @@ CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevirtualiza
 // Various policies for GuardedDevirtualization
 CONFIG_INTEGER(JitGuardedDevirtualizationChainLikelihood, W("JitGuardedDevirtualizationChainLikelihood"), 0x4B) // 75
 CONFIG_INTEGER(JitGuardedDevirtualizationChainStatements, W("JitGuardedDevirtualizationChainStatements"), 4)
+// Likelihood (percent) a class guess must reach before we guard on it; -1 uses
+// the built-in defaults (25 for interface calls, 30 for virtual calls).
+CONFIG_INTEGER(JitGuardedDevirtualizationLikelihoodThreshold, W("JitGuardedDevirtualizationLikelihoodThreshold"), -1)
 #if defined(DEBUG)
 CONFIG_STRING(JitGuardedDevirtualizationRange, W("JitGuardedDevirtualizationRange"))
 CONFIG_INTEGER(JitRandomGuardedDevirtualization, W("JitRandomGuardedDevirtualization"), 0)
@@ -511,6 +527,9 @@ CONFIG_INTEGER(JitMinimalPrejitProfiling, W("JitMinimalPrejitProfiling"), 0)
 CONFIG_INTEGER(JitClassProfiling, W("JitClassProfiling"), 1)
 CONFIG_INTEGER(JitEdgeProfiling, W("JitEdgeProfiling"), 1)
 CONFIG_INTEGER(JitCollect64BitCounts, W("JitCollect64BitCounts"), 0) // Collect counts as 64-bit values.
+// Use the scalable count helper for block and edge probes instead of racy inline increments. Hot counters are
+// updated probabilistically by the helper, avoiding cache line ping-pong on heavily threaded workloads.
+CONFIG_INTEGER(JitScalableProfileCounters, W("JitScalableProfileCounters"), 0)
 
 // Profile consumption options
 CONFIG_INTEGER(JitDisablePgo, W("JitDisablePgo"), 0) // Ignore pgo data for all methods
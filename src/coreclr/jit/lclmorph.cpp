@@ -398,16 +398,14 @@ public:
             unsigned lclNum = node->AsLclVarCommon()->GetLclNum();
 
             LclVarDsc* varDsc = m_compiler->lvaGetDesc(lclNum);
+            UpdateEarlyRefCount(lclNum);
+
             if (varDsc->lvIsStructField)
             {
                 // Promoted field, increase counter for the parent lclVar.
                 assert(!m_compiler->lvaIsImplicitByRefLocal(lclNum));
                 unsigned parentLclNum = varDsc->lvParentLcl;
-                UpdateEarlyRefCountForImplicitByRef(parentLclNum);
-            }
-            else
-            {
-                UpdateEarlyRefCountForImplicitByRef(lclNum);
+                UpdateEarlyRefCount(parentLclNum);
             }
         }
 
@@ -1112,7 +1110,7 @@ private:
     }
 
     //------------------------------------------------------------------------
-    // UpdateEarlyRefCountForImplicitByRef: updates the ref count for implicit byref params.
+    // UpdateEarlyRefCount: updates the ref count for locals
     //
     // Arguments:
     //    lclNum - the local number to update the count for.
@@ -1120,20 +1118,25 @@ private:
     // Notes:
     //    fgMakeOutgoingStructArgCopy checks the ref counts for implicit byref params when it decides
     //    if it's legal to elide certain copies of them;
-    //    fgRetypeImplicitByRefArgs checks the ref counts when it decides to undo promotions.
+    //    fgRetypeImplicitByRefArgs checks the ref counts when it decides to undo promotions;
+    //    fgForwardSub uses ref counts to decide when to forward sub.
     //
-    void UpdateEarlyRefCountForImplicitByRef(unsigned lclNum)
+    void UpdateEarlyRefCount(unsigned lclNum)
     {
+        LclVarDsc* varDsc = m_compiler->lvaGetDesc(lclNum);
+
+        // Note we don't need accurate counts when the values are large.
+        //
+        if (varDsc->lvRefCnt(RCS_EARLY) < USHRT_MAX)
+        {
+            varDsc->incLvRefCnt(1, RCS_EARLY);
+        }
+
         if (!m_compiler->lvaIsImplicitByRefLocal(lclNum))
         {
             return;
         }
 
-        LclVarDsc* varDsc = m_compiler->lvaGetDesc(lclNum);
-        JITDUMP("LocalAddressVisitor incrementing ref count from %d to %d for implicit by-ref V%02d\n",
-                varDsc->lvRefCnt(RCS_EARLY), varDsc->lvRefCnt(RCS_EARLY) + 1, lclNum);
-        varDsc->incLvRefCnt(1, RCS_EARLY);
-
         // See if this struct is an argument to a call. This information is recorded
         // via the weighted early ref count for the local, and feeds the undo promotion
         // heuristic.
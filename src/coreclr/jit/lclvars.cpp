@@ -2054,15 +2054,17 @@ bool Compiler::StructPromotionHelper::ShouldPromoteStructVar(unsigned lclNum)
     // than doing a whole-variable block operation (e.g., a hardware "copy loop" on x86).
     // Struct promotion also provides the following benefits: reduce stack frame size,
     // reduce the need for zero init of stack frame and fine grained constant/copy prop.
-    // Asm diffs indicate that promoting structs up to 3 fields is a net size win.
-    // So if no fields are accessed independently, and there are four or more fields,
-    // then do not promote.
+    // Asm diffs indicate that promoting structs up to 4 fields is a net win;
+    // common value types in async/span-heavy code (task builders, enumerator
+    // state) have exactly 4 fields and benefit from staying in registers
+    // across calls. So if no fields are accessed independently, and there are
+    // five or more fields, then do not promote.
     //
     // TODO: Ideally we would want to consider the impact of whether the struct is
     // passed as a parameter or assigned the return value of a call. Because once promoted,
     // struct copying is done by field by field assignment instead of a more efficient
     // rep.stos or xmm reg based copy.
-    if (structPromotionInfo.fieldCnt > 3 && !varDsc->lvFieldAccessed)
+    if (structPromotionInfo.fieldCnt > 4 && !varDsc->lvFieldAccessed)
     {
         JITDUMP("Not promoting promotable struct local V%02u: #fields = %d, fieldAccessed = %d.\n", lclNum,
                 structPromotionInfo.fieldCnt, varDsc->lvFieldAccessed);
@@ -895,17 +895,6 @@ bool Lowering::TryLowerSwitchToBitTest(
         }
     }
 
-    //
-    // One of the case blocks has to follow the switch block. This requirement could be avoided
-    // by adding a BBJ_ALWAYS block after the switch block but doing that sometimes negatively
-    // impacts register allocation.
-    //
-
-    if ((bbSwitch->bbNext != bbCase0) && (bbSwitch->bbNext != bbCase1))
-    {
-        return false;
-    }
-
 #ifdef TARGET_64BIT
     //
     // See if we can avoid a 8 byte immediate on 64 bit targets. If all upper 32 bits are 1
@@ -922,6 +911,22 @@ bool Lowering::TryLowerSwitchToBitTest(
     }
 #endif
 
+    //
+    // The JCC below falls through to one of the case blocks. When neither case block
+    // follows the switch block (the cases were laid out elsewhere), route the fall
+    // through edge to bbCase0 via a new empty jump block. The extra unconditional
+    // branch is still cheaper than the jump table load and indirect jump that this
+    // switch would otherwise get.
+    //
+
+    BasicBlock* bbJumpToCase0 = nullptr;
+    if ((bbSwitch->bbNext != bbCase0) && (bbSwitch->bbNext != bbCase1))
+    {
+        bbJumpToCase0 = comp->fgNewBBafter(BBJ_ALWAYS, bbSwitch, true);
+        bbJumpToCase0->bbJumpDest = bbCase0;
+        bbJumpToCase0->inheritWeight(bbSwitch);
+    }
+
     //
     // Rewire the blocks as needed and figure out the condition to use for JCC.
     //
@@ -932,7 +937,18 @@ bool Lowering::TryLowerSwitchToBitTest(
     comp->fgRemoveAllRefPreds(bbCase1, bbSwitch);
     comp->fgRemoveAllRefPreds(bbCase0, bbSwitch);
 
-    if (bbSwitch->bbNext == bbCase0)
+    if (bbJumpToCase0 != nullptr)
+    {
+        // Fall through to the new jump block (and on to bbCase0) when the bit is not
+        // set; GenCondition::C generates JC so we jump to bbCase1 when the bit is set.
+        bbSwitchCondition    = GenCondition::C;
+        bbSwitch->bbJumpDest = bbCase1;
+
+        comp->fgAddRefPred(bbJumpToCase0, bbSwitch);
+        comp->fgAddRefPred(bbCase0, bbJumpToCase0);
+        comp->fgAddRefPred(bbCase1, bbSwitch);
+    }
+    else if (bbSwitch->bbNext == bbCase0)
     {
         // GenCondition::C generates JC so we jump to bbCase1 when the bit is set
         bbSwitchCondition    = GenCondition::C;
@@ -803,7 +803,10 @@ private:
     {
         if ((lsraStressMask & LSRA_TRAVERSE_MASK) == 0)
         {
-            return LSRA_TRAVERSE_DEFAULT;
+            // The traversal order only matters for cross-block enregistration,
+            // so when we aren't enregistering locals (e.g. MinOpts) we use the
+            // cheap layout order rather than computing a pred-first order.
+            return enregisterLocalVars ? LSRA_TRAVERSE_DEFAULT : LSRA_TRAVERSE_LAYOUT;
         }
         return (LsraTraversalOrder)(lsraStressMask & LSRA_TRAVERSE_MASK);
     }
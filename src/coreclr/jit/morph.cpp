@@ -5684,7 +5684,12 @@ GenTree* Compiler::fgMorphArrayIndex(GenTree* tree)
         }
         else
         {
-            index = gtNewCastNode(TYP_I_IMPL, index, false, TYP_I_IMPL);
+            // If the index is covered by a bounds check then it is known to be non-negative
+            // here, so we can widen it with a zero extension instead of a sign extension.
+            // A 32-bit mov already zero extends on x64 and arm64, which lets the backend
+            // elide the extension entirely when the index is a 32-bit loop counter, instead
+            // of emitting a movsxd/sxtw on every iteration.
+            index = gtNewCastNode(TYP_I_IMPL, index, chkd, TYP_I_IMPL);
         }
     }
 #endif // TARGET_64BIT
@@ -15970,9 +15975,14 @@ void Compiler::fgMorphBlocks()
 
 #if LOCAL_ASSERTION_PROP
     //
-    // Local assertion prop is enabled if we are optimized
+    // Local assertion prop is enabled if we are optimized. Since it is forward-only
+    // and block-local (no dataflow iteration) it is also cheap enough to run when we
+    // are not optimizing, where it mostly removes redundant null checks and casts
+    // from Tier-0 code. We keep it off for debuggable code so that values the
+    // debugger writes to locals are not bypassed by copy/constant propagation.
     //
-    optLocalAssertionProp = opts.OptimizationEnabled();
+    optLocalAssertionProp = opts.OptimizationEnabled() ||
+                            (!opts.compDbgCode && (JitConfig.JitEnableTier0LocalAssertionProp() != 0));
 
     if (optLocalAssertionProp)
     {
@@ -3665,9 +3665,17 @@ PhaseStatus Compiler::optUnrollLoops()
         }
         else if (!(loopFlags & LPFLG_SIMD_LIMIT))
         {
-            // Otherwise unroll only if limit is Vector_.Length
-            // (as a heuristic, not for correctness/structural reasons)
-            continue;
+            if (totalIter > 4)
+            {
+                // Otherwise unroll only if limit is Vector_.Length
+                // (as a heuristic, not for correctness/structural reasons)
+                continue;
+            }
+
+            // Very short constant loops are unrolled regardless of the limit
+            // kind (subject to the size limit below): the straight-line code
+            // they become is what CSE, VN and the SIMD-aware peepholes can
+            // actually optimize.
         }
 
         GenTree* incr = incrStmt->GetRootNode();
@@ -6296,12 +6304,19 @@ void Compiler::optHoistLoopBlocks(unsigned loopNum, ArrayStack<BasicBlock*>* blo
                     {
                         // For now, we give up on an expression that might raise an exception if it is after the
                         // first possible global side effect (and we assume we're after that if we're not in the first
-                        // block).
+                        // block). The exception is an expression that value numbering proved cannot throw - its
+                        // conservative exception set is empty (e.g. an indirection off a reference VN has shown to be
+                        // non-null) - since moving it cannot reorder an exception with the side effect.
                         // TODO-CQ: this is when we might do loop cloning.
                         //
                         if ((tree->gtFlags & GTF_EXCEPT) != 0)
                         {
-                            treeIsHoistable = false;
+                            ValueNumPair excSet = m_compiler->vnStore->VNPExceptionSet(tree->gtVNPair);
+                            if ((excSet.GetLiberal() != ValueNumStore::VNForEmptyExcSet()) ||
+                                (excSet.GetConservative() != ValueNumStore::VNForEmptyExcSet()))
+                            {
+                                treeIsHoistable = false;
+                            }
                         }
                     }
                 }
@@ -894,7 +894,7 @@ void RangeCheck::MergeAssertion(BasicBlock* block, GenTree* op, Range* pRange DE
 // Compute the range for a binary operation.
 Range RangeCheck::ComputeRangeForBinOp(BasicBlock* block, GenTreeOp* binop, bool monIncreasing DEBUGARG(int indent))
 {
-    assert(binop->OperIs(GT_ADD, GT_AND, GT_RSH, GT_LSH, GT_UMOD));
+    assert(binop->OperIs(GT_ADD, GT_SUB, GT_AND, GT_RSH, GT_LSH, GT_UMOD));
 
     GenTree* op1 = binop->gtGetOp1();
     GenTree* op2 = binop->gtGetOp2();
@@ -939,7 +939,15 @@ Range RangeCheck::ComputeRangeForBinOp(BasicBlock* block, GenTreeOp* binop, bool
     }
 
     // other operators are expected to be handled above.
-    assert(binop->OperIs(GT_ADD));
+    assert(binop->OperIs(GT_ADD, GT_SUB));
+
+    // Subtraction is handled as an add of the negated constant; span length and
+    // index chains produced by Slice commonly have the "x - cns" shape.
+    if (binop->OperIs(GT_SUB) && (!op2->IsIntCnsFitsInI32() || (op2->AsIntCon()->IconValue() == INT32_MIN)))
+    {
+        // only a (negatable) cns is supported for op2 of the subtract operator
+        return Range(Limit::keUnknown);
+    }
 
     Range* op1RangeCached = nullptr;
     Range  op1Range       = Limit(Limit::keUndef);
@@ -963,6 +971,16 @@ Range RangeCheck::ComputeRangeForBinOp(BasicBlock* block, GenTreeOp* binop, bool
         op1Range = *op1RangeCached;
     }
 
+    if (binop->OperIs(GT_SUB))
+    {
+        Range op2Range = Range(Limit(Limit::keConstant, -static_cast<int>(op2->AsIntCon()->IconValue())));
+        Range r        = RangeOps::Add(op1Range, op2Range);
+        JITDUMP("BinOp sub ranges %s %s = %s\n", op1Range.ToString(m_pCompiler->getAllocatorDebugOnly()),
+                op2Range.ToString(m_pCompiler->getAllocatorDebugOnly()),
+                r.ToString(m_pCompiler->getAllocatorDebugOnly()));
+        return r;
+    }
+
     Range* op2RangeCached;
     Range  op2Range = Limit(Limit::keUndef);
     // Check if the range value is already cached.
@@ -1100,8 +1118,16 @@ bool RangeCheck::DoesBinOpOverflow(BasicBlock* block, GenTreeOp* binop)
         return true;
     }
     // Get the cached ranges of op2
-    Range* op2Range = nullptr;
-    if (!GetRangeMap()->Lookup(op2, &op2Range))
+    Range  op2SubRange = Limit(Limit::keUndef);
+    Range* op2Range    = nullptr;
+    if (binop->OperIs(GT_SUB))
+    {
+        // ComputeRangeForBinOp never caches a range for the constant operand of
+        // a subtract, so reconstruct the negated constant here.
+        op2SubRange = Range(Limit(Limit::keConstant, -static_cast<int>(op2->AsIntCon()->IconValue())));
+        op2Range    = &op2SubRange;
+    }
+    else if (!GetRangeMap()->Lookup(op2, &op2Range))
     {
         return true;
     }
@@ -1184,6 +1210,13 @@ bool RangeCheck::ComputeDoesOverflow(BasicBlock* block, GenTree* expr)
     {
         overflows = DoesBinOpOverflow(block, expr->AsOp());
     }
+    // Subtracting a constant is an add of the negated constant; other subtracts
+    // were already given unknown ranges and are conservatively overflowing.
+    else if (expr->OperIs(GT_SUB) && expr->AsOp()->gtGetOp2()->IsIntCnsFitsInI32() &&
+             (expr->AsOp()->gtGetOp2()->AsIntCon()->IconValue() != INT32_MIN))
+    {
+        overflows = DoesBinOpOverflow(block, expr->AsOp());
+    }
     // GT_AND, GT_UMOD, GT_LSH and GT_RSH don't overflow
     // Actually, GT_LSH can overflow so it depends on the analysis done in ComputeRangeForBinOp
     else if (expr->OperIs(GT_AND, GT_RSH, GT_LSH, GT_UMOD))
@@ -1276,7 +1309,7 @@ Range RangeCheck::ComputeRange(BasicBlock* block, GenTree* expr, bool monIncreas
         MergeAssertion(block, expr, &range DEBUGARG(indent + 1));
     }
     // compute the range for binary operation
-    else if (expr->OperIs(GT_ADD, GT_AND, GT_RSH, GT_LSH, GT_UMOD))
+    else if (expr->OperIs(GT_ADD, GT_SUB, GT_AND, GT_RSH, GT_LSH, GT_UMOD))
     {
         range = ComputeRangeForBinOp(block, expr->AsOp(), monIncreasing DEBUGARG(indent + 1));
     }
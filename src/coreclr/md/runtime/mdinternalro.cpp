@@ -916,18 +916,23 @@ HRESULT MDInternalRO::FindParamOfMethod(// S_OK or error.
     if (ridEnd < ridStart)
         return CLDB_E_FILE_CORRUPT;
 
-    // loop through each param
-    //<TODO>@consider: parameters are sorted by sequence. Maybe a binary search?
-    //</TODO>
-    for (; ridStart < ridEnd; ridStart++)
-    {
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetParamRecord(ridStart, &pParamRec));
-        if (iSeq == m_LiteWeightStgdb.m_MiniMd.getSequenceOfParam(pParamRec))
+    // Parameters of a method are required to be sorted by sequence number
+    // (ECMA-335 II.22.33), so binary search the param list.
+    while (ridStart < ridEnd)
+    {
+        RID ridMid = ridStart + (ridEnd - ridStart) / 2;
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetParamRecord(ridMid, &pParamRec));
+        ULONG iSeqMid = m_LiteWeightStgdb.m_MiniMd.getSequenceOfParam(pParamRec);
+        if (iSeqMid == iSeq)
         {
             // parameter has the sequence number matches what we are looking for
-            *pparamdef = TokenFromRid(ridStart, mdtParamDef);
+            *pparamdef = TokenFromRid(ridMid, mdtParamDef);
             return S_OK;
         }
+        if (iSeqMid < iSeq)
+            ridStart = ridMid + 1;
+        else
+            ridEnd = ridMid;
     }
     return CLDB_E_RECORD_NOTFOUND;
 }
@@ -1175,12 +1180,15 @@ HRESULT MDInternalRO::FindTypeRefByName(  // S_OK or error.
         else if (tkRes != tkResolutionScope)
             continue;
 
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
-        if (strcmp(szNamespace, szNamespaceTmp))
+        // Compare the name before the namespace - it is far more selective
+        // (many rows share a namespace such as "System"), so most rows are
+        // rejected with a single string fetch.
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
+        if (strcmp(szNameTmp, szName))
             continue;
 
-        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeRef(pTypeRefRec, &szNameTmp));
-        if (!strcmp(szNameTmp, szName))
+        IfFailGo(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeRef(pTypeRefRec, &szNamespaceTmp));
+        if (!strcmp(szNamespace, szNamespaceTmp))
         {
             *ptk = TokenFromRid(i, mdtTypeRef);
             goto ErrExit;
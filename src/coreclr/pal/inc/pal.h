@@ -557,10 +557,30 @@ PALAPI
 // Start the jitdump file
 PAL_PerfJitDump_Start(const char* path);
 
+// One source position covered by a jitdump debug info record. The address is
+// the absolute address of the first instruction the position applies to.
+typedef struct _PerfJitDumpDebugEntry
+{
+    ULONG64 address;
+    ULONG lineNumber;
+    ULONG discriminator;
+} PerfJitDumpDebugEntry;
+
+// Optional line information for PAL_PerfJitDump_LogMethod. All entries share
+// a single source file name; perf inject turns them into DWARF line records
+// preceding the code load.
+typedef struct _PerfJitDumpDebugInfo
+{
+    const char* fileName;
+    ULONG entryCount;
+    const PerfJitDumpDebugEntry* entries;
+} PerfJitDumpDebugInfo;
+
 PALIMPORT
 int
 PALAPI
-// Log a method to the jitdump file.
+// Log a method to the jitdump file. debugInfo, when non-NULL, points to a
+// PerfJitDumpDebugInfo describing the method's line table.
 PAL_PerfJitDump_LogMethod(void* pCode, size_t codeSize, const char* symbol, void* debugInfo, void* unwindInfo);
 
 PALIMPORT
@@ -2505,6 +2525,7 @@ SetErrorMode(
 #define MEM_WRITE_WATCH                 0x200000
 #define MEM_LARGE_PAGES                 0x20000000
 #define MEM_RESERVE_EXECUTABLE          0x40000000 // reserve memory using executable memory allocator
+#define MEM_HUGEPAGES_HINT              0x80000000 // advise the OS to back the reservation with transparent huge pages (best effort)
 
 PALIMPORT
 HANDLE
@@ -2780,6 +2801,13 @@ VirtualProtect(
            IN DWORD flNewProtect,
            OUT PDWORD lpflOldProtect);
 
+PALIMPORT
+VOID
+PALAPI
+PAL_PrefetchMemory(
+           IN LPCVOID lpAddress,
+           IN SIZE_T dwSize);
+
 typedef struct _MEMORYSTATUSEX {
   DWORD     dwLength;
   DWORD     dwMemoryLoad;
@@ -3807,6 +3835,11 @@ BOOL
 PALAPI
 PAL_GetNumaProcessorNode(WORD procNo, WORD* node);
 
+PALIMPORT
+BOOL
+PALAPI
+PAL_IsPreferredProcessor(WORD procNo);
+
 PALIMPORT
 LPVOID
 PALAPI
@@ -28,6 +28,7 @@ Revision History:
 #include "pal/dbgmsg.h"
 #include "pal/file.h"
 #include "pal/filetime.h"
+#include "pal/utils.h"
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -388,11 +389,43 @@ FindNextFileA(
             }
             strcat_s( find_data->fname, sizeof(find_data->fname), ext );
 
-            /* get the attributes, but continue if it fails */
-            Attr = GetFileAttributesA(path);
+            /* One stat (with an lstat fallback for dangling symlinks) serves
+               both the attribute derivation here and the filetimes and size
+               below; calling GetFileAttributesA would stat the same path a
+               second time for every entry enumerated. */
+            stat_result = stat(path, &stat_data) == 0 ||
+            lstat(path, &stat_data) == 0;
+
+            /* derive the attributes the same way GetFileAttributesA does,
+               but continue if that fails */
+            Attr = INVALID_FILE_ATTRIBUTES;
+            if ( stat_result )
+            {
+                if ( (stat_data.st_mode & S_IFMT) == S_IFDIR )
+                {
+                    Attr = FILE_ATTRIBUTE_DIRECTORY;
+                }
+                else if ( (stat_data.st_mode & S_IFMT) == S_IFREG )
+                {
+                    Attr = 0;
+                }
+
+                if ( Attr != INVALID_FILE_ATTRIBUTES )
+                {
+                    if ( UTIL_IsReadOnlyBitsSet( &stat_data ) )
+                    {
+                        Attr |= FILE_ATTRIBUTE_READONLY;
+                    }
+
+                    if ( Attr == 0 )
+                    {
+                        Attr = FILE_ATTRIBUTE_NORMAL;
+                    }
+                }
+            }
             if (Attr == INVALID_FILE_ATTRIBUTES)
             {
-                WARN("GetFileAttributes returned -1 on file [%s]\n",
+                WARN("could not derive attributes for file [%s]\n",
                   *(find_data->next));
             }
             lpFindFileData->dwFileAttributes = Attr;
@@ -408,10 +441,7 @@ FindNextFileA(
             /* we don't support 8.3 filenames, so just leave it empty */
             lpFindFileData->cAlternateFileName[0] = 0;
 
-            /* get the filetimes */
-            stat_result = stat(path, &stat_data) == 0 ||
-            lstat(path, &stat_data) == 0;
-
+            /* the filetimes come from the same stat call above */
             find_data->next++;
 
             if ( stat_result )
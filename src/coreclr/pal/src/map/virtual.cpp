@@ -914,6 +914,16 @@ static LPVOID VIRTUALReserveMemory(
         if (pRetVal != nullptr)
         {
             MemSize = reservationSize;
+
+#ifdef MADV_HUGEPAGE
+            // Carve-outs from the preallocated executable region bypass
+            // ReserveVirtualMemory, so the transparent huge page hint has to
+            // be applied here. Best effort, same as in ReserveVirtualMemory.
+            if ((flAllocationType & MEM_HUGEPAGES_HINT) != 0)
+            {
+                madvise(pRetVal, MemSize, MADV_HUGEPAGE);
+            }
+#endif
         }
     }
 
@@ -1038,6 +1048,16 @@ static LPVOID ReserveVirtualMemory(
     madvise(pRetVal, MemSize, MADV_DONTDUMP);
 #endif
 
+#ifdef MADV_HUGEPAGE
+    if ((fAllocationType & MEM_HUGEPAGES_HINT) != 0)
+    {
+        // Best effort only. The kernel collapses pages into transparent huge
+        // pages as the region gets committed and touched; when it cannot, the
+        // region simply stays on regular pages, so the result is ignored.
+        madvise(pRetVal, MemSize, MADV_HUGEPAGE);
+    }
+#endif
+
     return pRetVal;
 }
 
@@ -1355,10 +1375,10 @@ VirtualAlloc(
     }
 
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_RESET | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE | MEM_LARGE_PAGES ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_RESET | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE | MEM_LARGE_PAGES | MEM_HUGEPAGES_HINT ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, or MEM_LARGE_PAGES.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, MEM_LARGE_PAGES, or MEM_HUGEPAGES_HINT.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -1782,6 +1802,34 @@ PALAPI VOID PAL_JitWriteProtect(bool writeEnable)
 }
 #endif // HOST_OSX && HOST_ARM64
 
+/*++
+Function:
+  PAL_PrefetchMemory
+
+Hints the OS to begin paging the given address range into memory ahead of
+first access. Purely advisory and best effort - errors are ignored.
+--*/
+VOID
+PALAPI
+PAL_PrefetchMemory(
+          IN LPCVOID lpAddress,
+          IN SIZE_T dwSize)
+{
+    PERF_ENTRY(PAL_PrefetchMemory);
+    ENTRY("PAL_PrefetchMemory(lpAddress=%p, dwSize=%u)\n", lpAddress, dwSize);
+
+    if (lpAddress != NULL && dwSize != 0)
+    {
+        UINT_PTR StartBoundary = (UINT_PTR)ALIGN_DOWN(lpAddress, GetVirtualPageSize());
+        SIZE_T MemSize = ALIGN_UP((UINT_PTR)lpAddress + dwSize, GetVirtualPageSize()) - StartBoundary;
+
+        (void)posix_madvise((LPVOID)StartBoundary, MemSize, POSIX_MADV_WILLNEED);
+    }
+
+    LOGEXIT("PAL_PrefetchMemory returns\n");
+    PERF_EXIT(PAL_PrefetchMemory);
+}
+
 #if HAVE_VM_ALLOCATE
 //---------------------------------------------------------------------------------------
 //
@@ -53,6 +53,7 @@ namespace
 #endif
 
         JIT_CODE_LOAD = 0,
+        JIT_CODE_DEBUG_INFO = 2,
     };
 
     uint64_t GetTimeStampNS()
@@ -125,6 +126,22 @@ namespace
         // Null terminated name
         // Optional native code
     };
+
+    struct JitCodeDebugInfoRecord
+    {
+        JitCodeDebugInfoRecord()
+        {
+            header.id = JIT_CODE_DEBUG_INFO;
+            header.timestamp = GetTimeStampNS();
+        }
+
+        RecordHeader header;
+        uint64_t code_addr;
+        uint64_t nr_entry;
+        // Followed by nr_entry entries, each consisting of:
+        //   uint64_t addr; uint32_t lineno; uint32_t discrim;
+        //   null terminated source file name
+    };
 };
 
 struct PerfJitDumpState
@@ -242,8 +259,64 @@ exit:
             record.code_size = codeSize;
             record.header.total_size = bytesRemaining;
 
+            // When line information was supplied, serialize a debug info
+            // record into one contiguous buffer. It is written through the
+            // same writev as the load record because perf inject requires the
+            // debug info to immediately precede the code load it describes.
+            char* debugBuffer = nullptr;
+            size_t debugSize = 0;
+            const PerfJitDumpDebugInfo* lines = (const PerfJitDumpDebugInfo*)debugInfo;
+
+            if (lines != nullptr && lines->entryCount != 0 && lines->fileName != nullptr)
+            {
+                size_t fileNameLen = strlen(lines->fileName) + 1;
+                size_t entrySize = sizeof(uint64_t) + 2 * sizeof(uint32_t) + fileNameLen;
+
+                debugSize = sizeof(JitCodeDebugInfoRecord) + lines->entryCount * entrySize;
+                debugBuffer = (char*)malloc(debugSize);
+
+                // Failing to allocate loses the line info for this method but
+                // not the method itself.
+                if (debugBuffer == nullptr)
+                {
+                    debugSize = 0;
+                }
+                else
+                {
+                    JitCodeDebugInfoRecord debugRecord;
+
+                    debugRecord.header.timestamp = record.header.timestamp;
+                    debugRecord.header.total_size = debugSize;
+                    debugRecord.code_addr = (uint64_t) pCode;
+                    debugRecord.nr_entry = lines->entryCount;
+
+                    char* cursor = debugBuffer;
+                    memcpy(cursor, &debugRecord, sizeof(debugRecord));
+                    cursor += sizeof(debugRecord);
+
+                    for (ULONG i = 0; i < lines->entryCount; ++i)
+                    {
+                        uint64_t addr = lines->entries[i].address;
+                        uint32_t lineno = lines->entries[i].lineNumber;
+                        uint32_t discrim = lines->entries[i].discriminator;
+
+                        memcpy(cursor, &addr, sizeof(addr));
+                        cursor += sizeof(addr);
+                        memcpy(cursor, &lineno, sizeof(lineno));
+                        cursor += sizeof(lineno);
+                        memcpy(cursor, &discrim, sizeof(discrim));
+                        cursor += sizeof(discrim);
+                        memcpy(cursor, lines->fileName, fileNameLen);
+                        cursor += fileNameLen;
+                    }
+                }
+            }
+
+            bytesRemaining += debugSize;
+
             iovec items[] = {
-                // ToDo insert debugInfo and unwindInfo record items immediately before the JitCodeLoadRecord.
+                // ToDo insert an unwindInfo record item immediately before the JitCodeLoadRecord.
+                { debugBuffer, debugSize },
                 { &record, sizeof(JitCodeLoadRecord) },
                 { (void *)symbol, symbolLen + 1 },
                 { pCode, codeSize },
@@ -252,10 +325,18 @@ exit:
 
             size_t itemsWritten = 0;
 
+            // Skip the empty leading slot so the partial write bookkeeping
+            // below never sees a zero length item.
+            if (debugBuffer == nullptr)
+                itemsWritten = 1;
+
             result = pthread_mutex_lock(&mutex);
 
             if (result != 0)
+            {
+                free(debugBuffer);
                 return FatalError(false);
+            }
 
             if (!enabled)
                 goto exit;
@@ -275,6 +356,7 @@ exit:
                     if (errno == EINTR)
                         continue;
 
+                    free(debugBuffer);
                     return FatalError(true);
                 }
 
@@ -306,6 +388,8 @@ exit:
             } while (true);
 
 exit:
+            free(debugBuffer);
+
             result = pthread_mutex_unlock(&mutex);
 
             if (result != 0)
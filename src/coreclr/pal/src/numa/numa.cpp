@@ -33,6 +33,10 @@ SET_DEFAULT_DEBUG_CHANNEL(NUMA);
 
 #include <algorithm>
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
 #include "numashim.h"
 
 using namespace CorUnix;
@@ -96,6 +100,158 @@ static bool ShouldOpenLibNuma()
 
 #endif // HAVE_NUMA_H
 
+#if defined(__linux__)
+
+// Per-CPU preference map parsed once from sysfs at initialization time. A
+// logical CPU is a preferred placement target for compute-heavy runtime
+// threads when it is the lowest numbered thread of its core (secondary SMT
+// threads are demoted) and, on hybrid parts, when the kernel reports it as a
+// performance core. NULL when the topology could not be determined, in which
+// case every CPU is treated as preferred.
+static bool* g_cpuPreferred = nullptr;
+static long g_topologyCpuCount = 0;
+
+static ssize_t ReadSysFsFile(const char* path, char* buffer, size_t bufferSize)
+{
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+    {
+        return -1;
+    }
+
+    ssize_t bytesRead;
+    do
+    {
+        bytesRead = read(fd, buffer, bufferSize - 1);
+    }
+    while (bytesRead == -1 && errno == EINTR);
+
+    close(fd);
+
+    if (bytesRead <= 0)
+    {
+        return -1;
+    }
+
+    buffer[bytesRead] = '\0';
+    return bytesRead;
+}
+
+// Marks every CPU named by a sysfs CPU list of the form "0-3,8,10-11" in the
+// passed in map.
+static void MarkCpusInList(const char* list, bool* map, long cpuCount, bool value)
+{
+    const char* p = list;
+    while (*p != '\0')
+    {
+        char* end;
+        long rangeStart = strtol(p, &end, 10);
+        if (end == p)
+        {
+            break;
+        }
+
+        long rangeEnd = rangeStart;
+        if (*end == '-')
+        {
+            const char* next = end + 1;
+            rangeEnd = strtol(next, &end, 10);
+            if (end == next)
+            {
+                break;
+            }
+        }
+
+        for (long cpu = rangeStart; cpu <= rangeEnd; cpu++)
+        {
+            if (cpu >= 0 && cpu < cpuCount)
+            {
+                map[cpu] = value;
+            }
+        }
+
+        if (*end != ',')
+        {
+            break;
+        }
+        p = end + 1;
+    }
+}
+
+static void TopologySupportInitialize()
+{
+    long cpuCount = sysconf(_SC_NPROCESSORS_CONF);
+    if (cpuCount <= 0)
+    {
+        return;
+    }
+
+    bool* preferred = (bool*)malloc(cpuCount * sizeof(bool));
+    if (preferred == nullptr)
+    {
+        return;
+    }
+
+    for (long cpu = 0; cpu < cpuCount; cpu++)
+    {
+        preferred[cpu] = true;
+    }
+
+    char buffer[4096];
+    char path[128];
+
+    // Demote secondary SMT threads: a CPU whose sibling list starts with a
+    // lower CPU number shares its core with that lower numbered CPU.
+    for (long cpu = 0; cpu < cpuCount; cpu++)
+    {
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%ld/topology/thread_siblings_list", cpu);
+        if (ReadSysFsFile(path, buffer, sizeof(buffer)) > 0)
+        {
+            char* end;
+            long firstSibling = strtol(buffer, &end, 10);
+            if (end != buffer && firstSibling != cpu)
+            {
+                preferred[cpu] = false;
+            }
+        }
+    }
+
+    // Demote efficiency cores. On hybrid parts the kernel publishes the set
+    // of performance cores under the cpu_core device; when that file is
+    // present, anything outside the set it describes is an efficiency core.
+    if (ReadSysFsFile("/sys/devices/cpu_core/cpus", buffer, sizeof(buffer)) > 0)
+    {
+        bool* performance = (bool*)malloc(cpuCount * sizeof(bool));
+        if (performance != nullptr)
+        {
+            memset(performance, 0, cpuCount * sizeof(bool));
+            MarkCpusInList(buffer, performance, cpuCount, true);
+
+            for (long cpu = 0; cpu < cpuCount; cpu++)
+            {
+                if (!performance[cpu])
+                {
+                    preferred[cpu] = false;
+                }
+            }
+
+            free(performance);
+        }
+    }
+
+    g_cpuPreferred = preferred;
+    g_topologyCpuCount = cpuCount;
+}
+
+static void TopologySupportCleanup()
+{
+    free(g_cpuPreferred);
+    g_cpuPreferred = nullptr;
+    g_topologyCpuCount = 0;
+}
+
+#endif // __linux__
+
 /*++
 Function:
   NUMASupportInitialize
@@ -108,6 +264,9 @@ a single group of processors.
 BOOL
 NUMASupportInitialize()
 {
+#if defined(__linux__)
+    TopologySupportInitialize();
+#endif // __linux__
 #if HAVE_NUMA_H
     if (!ShouldOpenLibNuma())
     {
@@ -162,6 +321,9 @@ Cleanup of the NUMA support data structures
 VOID
 NUMASupportCleanup()
 {
+#if defined(__linux__)
+    TopologySupportCleanup();
+#endif // __linux__
 #if HAVE_NUMA_H
     if (g_numaAvailable)
     {
@@ -227,6 +389,36 @@ PAL_GetNumaProcessorNode(WORD procNo, WORD* node)
     return FALSE;
 }
 
+/*++
+Function:
+  PAL_IsPreferredProcessor
+
+Abstract
+  Returns whether a logical processor is a preferred placement target for
+  compute-heavy runtime threads, i.e. the first SMT thread of its core and,
+  on hybrid CPUs, a performance core. When no topology information is
+  available every processor is reported as preferred.
+
+Parameters:
+  procNo - number of the processor to query
+
+Return value:
+  TRUE if the processor is a preferred placement target.
+--*/
+BOOL
+PALAPI
+PAL_IsPreferredProcessor(WORD procNo)
+{
+#if defined(__linux__)
+    if (g_cpuPreferred != nullptr && (long)procNo < g_topologyCpuCount)
+    {
+        return g_cpuPreferred[procNo];
+    }
+#endif // __linux__
+
+    return TRUE;
+}
+
 /*++
 Function:
   VirtualAllocExNuma
@@ -40,6 +40,39 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 
 #include <algorithm>
 
+#if defined(__linux__) && HAVE_CLOCK_MONOTONIC && HAVE_PTHREAD_CONDATTR_SETCLOCK
+// On Linux the per-thread blocking handshake in ThreadNativeWait and
+// SignalThreadCondition uses a futex on the predicate word directly instead
+// of the mutex/condition pair, so a blocked acquisition and its wakeup cost
+// one syscall each with no mutex handshake on either side. The mutex and
+// condition are still initialized: the mutex keeps protecting thread
+// suspension (see AcquireSuspensionLocks) and the pair is still used for the
+// self-contained worker thread shutdown handshake in PrepareForShutdown.
+// Cross-process wakeups are unaffected; they travel through the process pipe
+// into the target process, where they are delivered via this local path.
+#define SYNCHMGR_FUTEX_WAKEUP 1
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+namespace
+{
+    int FutexWait(int * piFutex, int iExpected, const struct timespec * ptsAbsTmo)
+    {
+        // FUTEX_WAIT_BITSET with FUTEX_BITSET_MATCH_ANY takes an absolute
+        // CLOCK_MONOTONIC timeout, matching what GetAbsoluteTimeout produces
+        // when a monotonic clock is preferred; a null timeout blocks forever.
+        return syscall(SYS_futex, piFutex, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+                       iExpected, ptsAbsTmo, nullptr, FUTEX_BITSET_MATCH_ANY);
+    }
+
+    int FutexWake(int * piFutex)
+    {
+        return syscall(SYS_futex, piFutex, FUTEX_WAKE | FUTEX_PRIVATE_FLAG,
+                       1, nullptr, nullptr, 0);
+    }
+}
+#endif // __linux__ && HAVE_CLOCK_MONOTONIC && HAVE_PTHREAD_CONDATTR_SETCLOCK
+
 const int CorUnix::CThreadSynchronizationInfo::PendingSignalingsArraySize;
 
 // We use the synchronization manager's worker thread to handle
@@ -444,7 +477,10 @@ namespace CorUnix
         DWORD * pdwSignaledObject)
     {
         PAL_ERROR palErr = NO_ERROR;
-        int iRet, iWaitRet = 0;
+#if !SYNCHMGR_FUTEX_WAKEUP
+        int iRet;
+#endif // !SYNCHMGR_FUTEX_WAKEUP
+        int iWaitRet = 0;
         struct timespec tsAbsTmo;
 
         TRACE("ThreadNativeWait(ptnwdNativeWaitData=%p, dwTimeout=%u, ...)\n",
@@ -461,6 +497,43 @@ namespace CorUnix
             }
         }
 
+#if SYNCHMGR_FUTEX_WAKEUP
+        // Wait for the predicate to be set, consuming it on wakeup. The
+        // interlocked exchange is a full barrier, so once it observes the
+        // predicate, the wakeup reason and object index written by the
+        // signaling thread before it set the predicate are visible too.
+        while (0 == InterlockedExchange((LONG volatile *)&ptnwdNativeWaitData->iPred, FALSE))
+        {
+            if (-1 == FutexWait(&ptnwdNativeWaitData->iPred, 0,
+                                (INFINITE == dwTimeout) ? nullptr : &tsAbsTmo))
+            {
+                if (ETIMEDOUT == errno)
+                {
+                    _ASSERT_MSG(INFINITE != dwTimeout,
+                                "Got ETIMEDOUT despite timeout being INFINITE\n");
+
+                    // As in the condition variable path below, a predicate set
+                    // by a signaling racing with the timeout is deliberately
+                    // left in place: it is intended for the second native wait
+                    // (see comments in BlockThread).
+                    iWaitRet = ETIMEDOUT;
+                    break;
+                }
+                if (EAGAIN != errno && EINTR != errno)
+                {
+                    ERROR("futex wait failed [errno=%d (%s)]\n",
+                          errno, strerror(errno));
+                    palErr = ERROR_INTERNAL_ERROR;
+                    iWaitRet = errno;
+                    break;
+                }
+
+                // EAGAIN means the predicate was set before the kernel could
+                // queue the wait, EINTR is a signal-induced spurious wakeup:
+                // in both cases just check the predicate again.
+            }
+        }
+#else // SYNCHMGR_FUTEX_WAKEUP
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -531,6 +604,7 @@ namespace CorUnix
         }
 
         _ASSERT_MSG(ETIMEDOUT != iRet || INFINITE != dwTimeout, "Got timeout return code with INFINITE timeout\n");
+#endif // SYNCHMGR_FUTEX_WAKEUP
 
         if (0 == iWaitRet)
         {
@@ -2473,6 +2547,21 @@ namespace CorUnix
         ThreadNativeWaitData * ptnwdNativeWaitData)
     {
         PAL_ERROR palErr = NO_ERROR;
+
+#if SYNCHMGR_FUTEX_WAKEUP
+        // The wakeup reason and the signaled object index have already been
+        // written by the caller; the interlocked exchange is a full barrier,
+        // so they are published together with the predicate before the wake.
+        InterlockedExchange((LONG volatile *)&ptnwdNativeWaitData->iPred, TRUE);
+
+        if (-1 == FutexWake(&ptnwdNativeWaitData->iPred))
+        {
+            ERROR("futex wake failed [errno=%d (%s)]\n", errno, strerror(errno));
+            palErr = ERROR_INTERNAL_ERROR;
+        }
+
+        return palErr;
+#else // SYNCHMGR_FUTEX_WAKEUP
         int iRet;
 
         // Lock the mutex
@@ -2506,6 +2595,7 @@ namespace CorUnix
         }
 
         return palErr;
+#endif // SYNCHMGR_FUTEX_WAKEUP
     }
 
     /*++
@@ -0,0 +1,106 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//*****************************************************************************
+// cachelineaudit.cpp
+//
+// Registry and report for the debug-only false-sharing audit. See
+// cachelineaudit.h for usage.
+//*****************************************************************************
+
+#include "stdafx.h"
+#include "utilcode.h"
+#include "cachelineaudit.h"
+
+#ifdef _DEBUG
+
+// The registry is a fixed-size array so that registration works during early
+// startup, before any allocator or synchronization is usable. Bump the limit
+// if it fills up; overflowing entries are dropped with an assert.
+static const LONG MaxAuditEntries = 256;
+
+// Audit on the largest line size we ship on (arm64 big cores use 128 bytes),
+// so a pair that is safe on x64 but collides on arm64 is still reported.
+static const size_t AuditCacheLineSize = 128;
+
+struct AuditEntry
+{
+    LPCSTR name;
+    size_t address;
+    size_t size;
+};
+
+static AuditEntry s_auditEntries[MaxAuditEntries];
+static LONG s_auditEntryCount = 0;
+
+void CacheLineAuditRegister(LPCSTR name, const void* address, size_t size)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LONG index = InterlockedIncrement(&s_auditEntryCount) - 1;
+    if (index >= MaxAuditEntries)
+    {
+        _ASSERTE(!"Cache line audit registry is full - increase MaxAuditEntries");
+        return;
+    }
+
+    s_auditEntries[index].name = name;
+    s_auditEntries[index].address = (size_t)address;
+    s_auditEntries[index].size = size;
+}
+
+static int __cdecl CompareAuditEntries(const void* p1, const void* p2)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    const AuditEntry* e1 = (const AuditEntry*)p1;
+    const AuditEntry* e2 = (const AuditEntry*)p2;
+    if (e1->address < e2->address)
+        return -1;
+    if (e1->address > e2->address)
+        return 1;
+    return 0;
+}
+
+void CacheLineAuditReport()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LONG count = s_auditEntryCount;
+    if (count > MaxAuditEntries)
+        count = MaxAuditEntries;
+
+    qsort(s_auditEntries, count, sizeof(AuditEntry), CompareAuditEntries);
+
+    fprintf(stderr, "Cache line audit: %d entries, %d byte lines\n",
+        (int)count, (int)AuditCacheLineSize);
+
+    // Symbol map for correlating against external cache line profilers.
+    for (LONG i = 0; i < count; i++)
+    {
+        fprintf(stderr, "  %p %4d %s\n",
+            (void*)s_auditEntries[i].address, (int)s_auditEntries[i].size, s_auditEntries[i].name);
+    }
+
+    // The entries are sorted, so an entry can only share a line with its
+    // neighbor: compare each entry's first line against the previous entry's
+    // last line (an entry larger than a line spans several).
+    int warnings = 0;
+    for (LONG i = 1; i < count; i++)
+    {
+        size_t prevLastLine = (s_auditEntries[i - 1].address + s_auditEntries[i - 1].size - 1) / AuditCacheLineSize;
+        size_t firstLine = s_auditEntries[i].address / AuditCacheLineSize;
+
+        if (firstLine <= prevLastLine)
+        {
+            fprintf(stderr, "  WARNING: '%s' and '%s' share the cache line at %p\n",
+                s_auditEntries[i - 1].name, s_auditEntries[i].name,
+                (void*)(firstLine * AuditCacheLineSize));
+            warnings++;
+        }
+    }
+
+    fprintf(stderr, "Cache line audit: %d shared line(s)\n", warnings);
+}
+
+#endif // _DEBUG
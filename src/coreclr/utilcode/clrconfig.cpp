@@ -102,15 +102,8 @@ namespace
     };
 
     bool s_fUseEnvCache = false;
-    ProbabilisticNameSet s_EnvNames; // set of environment value names seen
-
-    bool EnvCacheValueNameSeenPerhaps(LPCWSTR name)
-    {
-        WRAPPER_NO_CONTRACT;
-
-        return !s_fUseEnvCache
-            || s_EnvNames.MayContain(name);
-    }
+    ProbabilisticNameSet s_DotNetEnvNames;  // set of DOTNET_-prefixed environment value names seen
+    ProbabilisticNameSet s_ComPlusEnvNames; // set of COMPlus_-prefixed environment value names seen
 
     bool CheckLookupOption(const ConfigDWORDInfo & info, LookupOptions option)
     {
@@ -171,13 +164,25 @@ namespace
                 return NULL;
             }
 
-            // Check if the name has been cached.
-            if (!EnvCacheValueNameSeenPerhaps(name))
+            // Check if the name has been cached. The sets are kept per prefix so that a
+            // name only present in its COMPlus_ form doesn't cost a DOTNET_ probe first
+            // (or vice versa).
+            bool tryDotnet  = !s_fUseEnvCache || s_DotNetEnvNames.MayContain(name);
+            bool tryComplus = !s_fUseEnvCache || s_ComPlusEnvNames.MayContain(name);
+            if (!tryDotnet && !tryComplus)
                 return NULL;
 
             // Priority order is DOTNET_ and then COMPlus_.
-            wcscpy_s(buff, _countof(buff), DOTNET_PREFIX);
-            fallbackPrefix = COMPLUS_PREFIX;
+            if (tryDotnet)
+            {
+                wcscpy_s(buff, _countof(buff), DOTNET_PREFIX);
+                if (tryComplus)
+                    fallbackPrefix = COMPLUS_PREFIX;
+            }
+            else
+            {
+                wcscpy_s(buff, _countof(buff), COMPLUS_PREFIX);
+            }
         }
 
         wcscat_s(buff, _countof(buff), name);
@@ -647,13 +652,13 @@ void CLRConfig::Initialize()
                         && SString::_wcsnicmp(wszName, COMPLUS_PREFIX, LEN_OF_COMPLUS_PREFIX) == 0)
                     {
                         wszName += LEN_OF_COMPLUS_PREFIX;
-                        s_EnvNames.Add(wszName, (DWORD) (wszCurr - wszName));
+                        s_ComPlusEnvNames.Add(wszName, (DWORD) (wszCurr - wszName));
                     }
                     else if (matchD
                         && SString::_wcsnicmp(wszName, DOTNET_PREFIX, LEN_OF_DOTNET_PREFIX) == 0)
                     {
                         wszName += LEN_OF_DOTNET_PREFIX;
-                        s_EnvNames.Add(wszName, (DWORD) (wszCurr - wszName));
+                        s_DotNetEnvNames.Add(wszName, (DWORD) (wszCurr - wszName));
                     }
                 }
             }
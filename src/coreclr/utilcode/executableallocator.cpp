@@ -15,6 +15,8 @@ BYTE * ExecutableAllocator::g_codeAllocHint;
 
 bool ExecutableAllocator::g_isWXorXEnabled = false;
 
+bool ExecutableAllocator::g_isHugePagesHintEnabled = false;
+
 ExecutableAllocator::FatalErrorHandler ExecutableAllocator::g_fatalErrorHandler = NULL;
 
 ExecutableAllocator* ExecutableAllocator::g_instance = NULL;
@@ -145,6 +147,21 @@ ExecutableAllocator::~ExecutableAllocator()
 {
     if (IsDoubleMappingEnabled())
     {
+        for (int i = 0; i < CachedMappingCount; i++)
+        {
+            BlockRW* pBlock = m_cachedMappings[i];
+            if (pBlock != NULL)
+            {
+                void* unmapAddress = NULL;
+                size_t unmapSize;
+
+                if (RemoveRWBlock(pBlock->baseRW, &unmapAddress, &unmapSize) && (unmapAddress != NULL))
+                {
+                    VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize);
+                }
+            }
+        }
+
         VMToOSInterface::DestroyDoubleMemoryMapper(m_doubleMemoryMapperHandle);
     }
 }
@@ -155,6 +172,7 @@ HRESULT ExecutableAllocator::StaticInitialize(FatalErrorHandler fatalErrorHandle
 
     g_fatalErrorHandler = fatalErrorHandler;
     g_isWXorXEnabled = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_EnableWriteXorExecute) != 0;
+    g_isHugePagesHintEnabled = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_CodeHeapTransparentHugePages) != 0;
     g_instance = new (nothrow) ExecutableAllocator();
     if (g_instance == NULL)
     {
@@ -186,23 +204,30 @@ bool ExecutableAllocator::Initialize()
     return true;
 }
 
-//#define ENABLE_CACHED_MAPPINGS
-
 void ExecutableAllocator::UpdateCachedMapping(BlockRW* pBlock)
 {
     LIMITED_METHOD_CONTRACT;
-#ifdef ENABLE_CACHED_MAPPINGS
-    if (m_cachedMapping == NULL)
+
+    // Runs under m_CriticalSection, taken by the MapRW / UnmapRW callers.
+    for (int i = 0; i < CachedMappingCount; i++)
     {
-        m_cachedMapping = pBlock;
-        pBlock->refCount++;
+        if (m_cachedMappings[i] == pBlock)
+        {
+            // Already cached
+            return;
+        }
     }
-    else if (m_cachedMapping != pBlock)
+
+    int victim = m_cachedMappingVictim;
+    m_cachedMappingVictim = (victim + 1) % CachedMappingCount;
+
+    BlockRW* pVictimBlock = m_cachedMappings[victim];
+    if (pVictimBlock != NULL)
     {
         void* unmapAddress = NULL;
         size_t unmapSize;
 
-        if (!RemoveRWBlock(m_cachedMapping->baseRW, &unmapAddress, &unmapSize))
+        if (!RemoveRWBlock(pVictimBlock->baseRW, &unmapAddress, &unmapSize))
         {
             g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
         }
@@ -210,10 +235,10 @@ void ExecutableAllocator::UpdateCachedMapping(BlockRW* pBlock)
         {
             g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
         }
-        m_cachedMapping = pBlock;
-        pBlock->refCount++;
     }
-#endif // ENABLE_CACHED_MAPPINGS    
+
+    m_cachedMappings[victim] = pBlock;
+    pBlock->refCount++;
 }
 
 void* ExecutableAllocator::FindRWBlock(void* baseRX, size_t size)
@@ -348,6 +373,21 @@ void* ExecutableAllocator::Commit(void* pStart, size_t size, bool isExecutable)
     }
 }
 
+bool ExecutableAllocator::Decommit(void* pStart, size_t size)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (IsDoubleMappingEnabled())
+    {
+        // The committed pages are backed by a shared file that both the RX and RW mappings
+        // reference, so they cannot be returned to the OS without invalidating potential RW
+        // mappings of the range. Leave them committed.
+        return false;
+    }
+
+    return ClrVirtualFree(pStart, size, MEM_DECOMMIT) != FALSE;
+}
+
 void ExecutableAllocator::Release(void* pRX)
 {
     LIMITED_METHOD_CONTRACT;
@@ -537,6 +577,11 @@ void* ExecutableAllocator::ReserveWithinRange(size_t size, const void* loAddress
         // This will allow us to place JIT'ed code close to the coreclr library
         // and thus improve performance by avoiding jump stubs in managed code.
         allocationType |= MEM_RESERVE_EXECUTABLE;
+
+        if (g_isHugePagesHintEnabled)
+        {
+            allocationType |= MEM_HUGEPAGES_HINT;
+        }
 #endif
         return ClrVirtualAllocWithinRange((const BYTE*)loAddress, (const BYTE*)hiAddress, size, allocationType, PAGE_NOACCESS);
     }
@@ -623,6 +668,11 @@ void* ExecutableAllocator::Reserve(size_t size)
             // This will allow us to place JIT'ed code close to the coreclr library
             // and thus improve performance by avoiding jump stubs in managed code.
             allocationType |= MEM_RESERVE_EXECUTABLE;
+
+            if (g_isHugePagesHintEnabled)
+            {
+                allocationType |= MEM_HUGEPAGES_HINT;
+            }
 #endif
             result = (BYTE*)ClrVirtualAlloc(NULL, size, allocationType, PAGE_NOACCESS);
         }
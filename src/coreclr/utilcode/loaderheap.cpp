@@ -1249,6 +1249,34 @@ BOOL UnlockedLoaderHeap::GetMoreCommittedPages(size_t dwMinSize)
     return UnlockedReservePages(dwMinSize);
 }
 
+void UnlockedLoaderHeap::UnlockedTrim()
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        FORBID_FAULT;
+    }
+    CONTRACTL_END;
+
+    // Only whole pages past the allocation pointer can go; a partially used page at the
+    // front of the committed tail has live allocations on it.
+    BYTE *pDecommitStart = (BYTE *)ALIGN_UP(m_pAllocPtr, GetOsPageSize());
+
+    if (pDecommitStart >= m_pPtrToEndOfCommittedRegion)
+        return;
+
+    size_t dwSizeToDecommit = (size_t)(m_pPtrToEndOfCommittedRegion - pDecommitStart);
+
+    // The next allocation that does not fit recommits on demand via GetMoreCommittedPages,
+    // so the only cost of an over-eager trim is an extra commit call later.
+    if (!ExecutableAllocator::Instance()->Decommit(pDecommitStart, dwSizeToDecommit))
+        return;
+
+    m_pPtrToEndOfCommittedRegion = pDecommitStart;
+    m_dwTotalAlloc -= dwSizeToDecommit;
+}
+
 void *UnlockedLoaderHeap::UnlockedAllocMem(size_t dwSize
                                            COMMA_INDEBUG(__in const char *szFile)
                                            COMMA_INDEBUG(int  lineNum))
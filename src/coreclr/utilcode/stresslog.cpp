@@ -348,6 +348,121 @@ void StressLog::Terminate(BOOL fProcessDetach) {
 #endif //!STRESS_LOG_READONLY
 }
 
+#if !defined(STRESS_LOG_READONLY) && !defined(STRESS_LOG_ANALYZER) && !defined(DACCESS_COMPILE)
+/*********************************************************************************/
+// Serializes the ring buffers into one contiguous blob so the diagnostics
+// server can hand the last moments of runtime activity to an out-of-process
+// client without taking a dump. The global lock keeps the thread list and the
+// chunk lists stable; running threads keep appending to their own rings while
+// the copy proceeds, so the newest message of a busy thread can be torn. A
+// reader validates chunk signatures and message headers anyway, and a torn
+// tail is the price of not suspending writers.
+
+BYTE* StressLog::CollectSnapshot(DWORD* pcbSnapshot)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    *pcbSnapshot = 0;
+
+    if (theLog.MaxSizePerThread == 0)
+    {
+        // The log was never initialized in this process.
+        return NULL;
+    }
+
+    StressLogLockHolder lockh(theLog.lock);
+
+    // First pass: size the blob.
+    uint64_t cbTotal = sizeof(SnapshotHeader);
+    uint32_t threadCount = 0;
+    for (ThreadStressLog* ptr = theLog.logs; ptr != NULL; ptr = ptr->next)
+    {
+        // Threads that could not allocate their first chunk have no ring.
+        if (ptr->chunkListHead == NULL)
+            continue;
+
+        threadCount++;
+        cbTotal += sizeof(SnapshotThread) +
+            (uint64_t)ptr->chunkListLength * (sizeof(SnapshotChunk) + STRESSLOG_CHUNK_SIZE);
+    }
+
+    if (cbTotal > UINT32_MAX)
+    {
+        return NULL;
+    }
+
+    BYTE* pSnapshot = new (nothrow) BYTE[(size_t)cbTotal];
+    if (pSnapshot == NULL)
+    {
+        return NULL;
+    }
+
+    BYTE* cursor = pSnapshot;
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = 0x4E534C53;  // 'SLSN'
+    header.version = 0x00010001;
+    header.tickFrequency = theLog.tickFrequency;
+    header.startTimeStamp = theLog.startTimeStamp;
+    header.moduleOffset = (uint64_t)theLog.moduleOffset;
+    for (size_t i = 0; i < MAX_MODULES; i++)
+    {
+        header.modules[i].baseAddress = (uint64_t)(size_t)theLog.modules[i].baseAddress;
+        header.modules[i].size = (uint64_t)theLog.modules[i].size;
+    }
+    header.threadCount = threadCount;
+
+    memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+
+    // Second pass: copy each thread's ring. The list can only have grown at
+    // its head since the first pass took the lock, and it didn't - the lock
+    // is still held - so the set of threads is exactly the one just counted.
+    for (ThreadStressLog* ptr = theLog.logs; ptr != NULL; ptr = ptr->next)
+    {
+        if (ptr->chunkListHead == NULL)
+            continue;
+
+        SnapshotThread threadRecord;
+        threadRecord.threadId = ptr->threadId;
+        threadRecord.curPtr = (uint64_t)(size_t)ptr->curPtr;
+        threadRecord.isDead = ptr->isDead;
+        threadRecord.chunkCount = (uint32_t)ptr->chunkListLength;
+
+        memcpy(cursor, &threadRecord, sizeof(threadRecord));
+        cursor += sizeof(threadRecord);
+
+        StressLogChunk* chunk = ptr->chunkListHead;
+        do
+        {
+            SnapshotChunk chunkRecord;
+            chunkRecord.address = (uint64_t)(size_t)chunk->StartPtr();
+
+            memcpy(cursor, &chunkRecord, sizeof(chunkRecord));
+            cursor += sizeof(chunkRecord);
+
+            memcpy(cursor, chunk->StartPtr(), STRESSLOG_CHUNK_SIZE);
+            cursor += STRESSLOG_CHUNK_SIZE;
+
+            chunk = chunk->next;
+        } while (chunk != ptr->chunkListHead);
+    }
+
+    _ASSERTE(cursor == pSnapshot + cbTotal);
+
+    *pcbSnapshot = (DWORD)cbTotal;
+    return pSnapshot;
+}
+
+void StressLog::FreeSnapshot(BYTE* pSnapshot)
+{
+    STATIC_CONTRACT_LEAF;
+
+    delete[] pSnapshot;
+}
+#endif //!STRESS_LOG_READONLY && !STRESS_LOG_ANALYZER && !DACCESS_COMPILE
+
 /*********************************************************************************/
 /* create a new thread stress log buffer associated with Thread local slot, for the Stress log */
 
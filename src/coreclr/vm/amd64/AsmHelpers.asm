@@ -683,18 +683,6 @@ LEAF_ENTRY xmmYmmStateSupport, _TEXT
 LEAF_END xmmYmmStateSupport, _TEXT
 
 
-; EXTERN_C void moveOWord(LPVOID* src, LPVOID* target);
-; <NOTE>
-; MOVDQA is not an atomic operation.  You need to call this function in a crst.
-; </NOTE>
-LEAF_ENTRY moveOWord, _TEXT
-        movdqa      xmm0, [rcx]
-        movdqa      [rdx], xmm0
-
-        ret
-LEAF_END moveOWord, _TEXT
-
-
 extern JIT_InternalThrowFromHelper:proc
 
 LEAF_ENTRY SinglecastDelegateInvokeStub, _TEXT
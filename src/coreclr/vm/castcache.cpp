@@ -94,10 +94,74 @@ BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
         return FALSE;
     }
 
+    // Carry complete entries over from the current table so that growing the cache
+    // does not behave like a flush and cause a burst of slow-path casts while the
+    // table refills. The new table is not published yet, thus can be written without
+    // synchronization. Entries added to the old table concurrently with the copy may
+    // be missed, which is acceptable for a lossy cache.
+    CopyOldEntries(TableData(*s_pTableRef), TableData(newTable));
+
     SetObjectReference((OBJECTREF *)s_pTableRef, newTable);
     return TRUE;
 }
 
+void CastCache::CopyOldEntries(DWORD* fromTableData, DWORD* toTableData)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    DWORD fromCount = CacheElementCount(fromTableData);
+    for (DWORD e = 0; e < fromCount; e++)
+    {
+        CastCacheEntry* pFromEntry = &Elements(fromTableData)[e];
+
+        // Read the entry the same way TryGet does.
+        // An unclaimed, claimed or changing entry is skipped.
+        DWORD version1 = VolatileLoad(&pFromEntry->version);
+        if ((version1 == 0) || (version1 & 1))
+        {
+            continue;
+        }
+
+        TADDR source          = pFromEntry->source;
+        TADDR targetAndResult = pFromEntry->targetAndResult;
+
+        // make sure 'version' is loaded after 'source' and 'targetAndResult'
+        VolatileLoadBarrier();
+        if (version1 != pFromEntry->version)
+        {
+            continue;
+        }
+
+        DWORD index = KeyToBucket(toTableData, source, targetAndResult & ~(TADDR)1);
+        for (DWORD i = 0; i < BUCKET_SIZE;)
+        {
+            CastCacheEntry* pToEntry = &Elements(toTableData)[index];
+            if (pToEntry->version == 0)
+            {
+                pToEntry->source          = source;
+                pToEntry->targetAndResult = targetAndResult;
+
+                // a complete entry that went through one update has an even version
+                // with numerical tag 2 and its probe distance in the upper bits.
+                pToEntry->version = ((DWORD)i << VERSION_NUM_SIZE) + 2;
+                break;
+            }
+
+            // quadratic reprobe.
+            // If the bucket fills up the entry is dropped, which is acceptable
+            // for a lossy cache.
+            i++;
+            index = (index + i) & TableMask(toTableData);
+        }
+    }
+}
+
 void CastCache::FlushCurrentCache()
 {
     CONTRACTL
@@ -318,6 +318,7 @@ private:
 
     static BASEARRAYREF CreateCastCache(DWORD size);
     static BOOL MaybeReplaceCacheWithLarger(DWORD size);
+    static void CopyOldEntries(DWORD* fromTableData, DWORD* toTableData);
     static TypeHandle::CastResult TryGet(TADDR source, TADDR target);
     static void TrySet(TADDR source, TADDR target, BOOL result);
 
@@ -168,6 +168,18 @@ TYPE LookupMap<TYPE>::GetElement(DWORD rid, TADDR* pFlags)
     }
 #endif // FEATURE_PREJIT
 
+    // The first node is sized up front to cover every rid in the module's metadata, so
+    // almost all lookups resolve right here with a bounds check and a load. Only rids
+    // added past that point (profiler / EnC growth) take the out-of-line node walk.
+    if (rid < dwCount
+#ifdef FEATURE_PREJIT
+        && dwNumHotItems == 0
+#endif
+        )
+    {
+        return GetValueAt(GetIndexPtr(rid), pFlags, supportedFlags);
+    }
+
     PTR_TADDR pElement = GetElementPtr(rid);
     return (pElement != NULL) ? GetValueAt(pElement, pFlags, supportedFlags) : NULL;
 }
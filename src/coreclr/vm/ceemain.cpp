@@ -150,6 +150,7 @@
 #include "comcallablewrapper.h"
 #include "../dlls/mscorrc/resource.h"
 #include "util.hpp"
+#include "cachelineaudit.h"
 #include "shimload.h"
 #include "comthreadpool.h"
 #include "posterror.h"
@@ -1053,6 +1054,19 @@ void EEStartupHelper()
 
         // Perform CoreLib consistency check if requested
         g_CoreLib.CheckExtended();
+
+        // Report any registered false-sharing candidates that ended up on a
+        // shared cache line. The thread suspension globals are registered here;
+        // components with private state (e.g. the threadpool) register their own
+        // fields during their initialization.
+        if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_AuditCacheLines) != 0)
+        {
+            CACHE_LINE_AUDIT(g_TrapReturningThreads);
+            CACHE_LINE_AUDIT(g_trtChgStamp);
+            CACHE_LINE_AUDIT(g_trtChgInFlight);
+            CACHE_LINE_AUDIT(g_fEEStarted);
+            CacheLineAuditReport();
+        }
 #endif // _DEBUG
 
 #endif // !CROSSGEN_COMPILE
@@ -1164,6 +1178,323 @@ HRESULT EEStartup()
 
 #ifndef CROSSGEN_COMPILE
 
+// ---------------------------------------------------------------------------
+// #EagerTypeLoad
+//
+// When EagerTypeLoadList names a manifest file, a background thread loads the
+// listed types while Main is starting up, so the first foreground touch of
+// each type finds it already loaded instead of paying for the full load on
+// the startup path.  Each manifest line has the form
+// AssemblyName!Namespace.TypeName; '#' starts a comment line.  Lines that
+// fail to resolve are skipped.  No extra synchronization is needed against
+// foreground loads of the same types: the loader's pending-load table
+// (code:PendingTypeLoadEntry) already serializes racing loaders and hands
+// the waiters the winner's result.
+// ---------------------------------------------------------------------------
+
+// Manifests are small hand-maintained lists; reject anything implausibly big.
+static const DWORD c_maxEagerTypeLoadManifestSize = 1024 * 1024;
+
+class EagerTypeLoadWorker
+{
+public:
+    EagerTypeLoadWorker()
+        : m_pThread(NULL)
+        , m_pManifest(NULL)
+        , m_cbManifest(0)
+    {
+        LIMITED_METHOD_CONTRACT;
+    }
+
+    ~EagerTypeLoadWorker()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        delete [] m_pManifest;
+    }
+
+    HRESULT ReadManifest(const WCHAR * pFileName);
+    HRESULT Start();
+
+private:
+    static DWORD WINAPI StaticThreadProc(void * args);
+
+    void Run();
+    void LoadLine(__inout_z char * pLine);
+
+    Thread * m_pThread;
+    BYTE   * m_pManifest;
+    DWORD    m_cbManifest;
+};
+
+
+HRESULT EagerTypeLoadWorker::ReadManifest(const WCHAR * pFileName)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    HANDLE hFile = WszCreateFile(pFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return COR_E_FILENOTFOUND;
+    }
+
+    HRESULT hr = S_OK;
+
+    DWORD cbFile = SafeGetFileSize(hFile, 0);
+
+    if ((cbFile == 0) || (cbFile >= c_maxEagerTypeLoadManifestSize))
+    {
+        hr = COR_E_BADIMAGEFORMAT;
+    }
+    else
+    {
+        m_pManifest = new (nothrow) BYTE[cbFile + 1];
+
+        if (m_pManifest == NULL)
+        {
+            hr = E_OUTOFMEMORY;
+        }
+        else
+        {
+            DWORD cbRead = 0;
+
+            if (::ReadFile(hFile, m_pManifest, cbFile, & cbRead, NULL) && (cbRead == cbFile))
+            {
+                m_pManifest[cbFile] = 0;
+                m_cbManifest = cbFile;
+            }
+            else
+            {
+                hr = CLDB_E_FILE_BADREAD;
+            }
+        }
+    }
+
+    CloseHandle(hFile);
+
+    return hr;
+}
+
+
+HRESULT EagerTypeLoadWorker::Start()
+{
+    STANDARD_VM_CONTRACT;
+
+    HRESULT hr = E_FAIL;
+
+    _ASSERTE(m_pThread == NULL);
+
+    m_pThread = SetupUnstartedThread();
+
+    _ASSERTE(m_pThread != NULL);
+
+    if (m_pThread->CreateNewThread(0, StaticThreadProc, this))
+    {
+        int t = (int) m_pThread->StartThread();
+
+        if (t > 0)
+        {
+            hr = S_OK;
+        }
+    }
+
+    return hr;
+}
+
+
+// Load one manifest line, modifying it in place while splitting it up.
+void EagerTypeLoadWorker::LoadLine(__inout_z char * pLine)
+{
+    STANDARD_VM_CONTRACT;
+
+    if ((*pLine == 0) || (*pLine == '#'))
+    {
+        return;
+    }
+
+    char * pTypeName = strchr(pLine, '!');
+
+    if ((pTypeName == NULL) || (pTypeName == pLine) || (pTypeName[1] == 0))
+    {
+        return;
+    }
+
+    *pTypeName++ = 0;
+
+    AssemblySpec spec;
+
+    if (FAILED(spec.Init(pLine)))
+    {
+        return;
+    }
+
+    DomainAssembly * pDomainAssembly = spec.LoadDomainAssembly(
+        FILE_LOADED,
+        FALSE); // Don't throw on FileNotFound.
+
+    if (pDomainAssembly == NULL)
+    {
+        return;
+    }
+
+    // Split the name the way metadata records it: everything before the last
+    // '.' is the namespace, possibly empty.
+    LPCUTF8 nameSpace = "";
+    char * pDot = strrchr(pTypeName, '.');
+
+    if (pDot != NULL)
+    {
+        *pDot = 0;
+        nameSpace = pTypeName;
+        pTypeName = pDot + 1;
+    }
+
+    ClassLoader::LoadTypeByNameThrowing(pDomainAssembly->GetAssembly(), nameSpace, pTypeName, ClassLoader::ReturnNullIfNotFound);
+}
+
+
+void EagerTypeLoadWorker::Run()
+{
+    STANDARD_VM_CONTRACT;
+
+    char * pCursor = (char *) m_pManifest;
+    char * pEnd = pCursor + m_cbManifest;
+
+    while (pCursor < pEnd)
+    {
+        char * pLine = pCursor;
+        char * pNewLine = strchr(pLine, '\n');
+
+        if (pNewLine != NULL)
+        {
+            * pNewLine = 0;
+            pCursor = pNewLine + 1;
+        }
+        else
+        {
+            pCursor = pEnd;
+        }
+
+        // Tolerate CRLF manifests.
+        size_t len = strlen(pLine);
+
+        if ((len > 0) && (pLine[len - 1] == '\r'))
+        {
+            pLine[len - 1] = 0;
+        }
+
+        // A bad entry only costs its own preload; swallow so one broken line
+        // does not abandon the rest of the manifest.
+        EX_TRY
+        {
+            LoadLine(pLine);
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+}
+
+
+DWORD WINAPI EagerTypeLoadWorker::StaticThreadProc(void * args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+    }
+    CONTRACTL_END;
+
+    BEGIN_ENTRYPOINT_NOTHROW;
+
+    EagerTypeLoadWorker * pWorker = (EagerTypeLoadWorker *) args;
+
+    if (pWorker != NULL)
+    {
+        Thread * pThread = pWorker->m_pThread;
+
+        if ((pThread != NULL) && pThread->HasStarted())
+        {
+            // Disable calling managed code in background thread
+            ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+            // Run as background thread, so ThreadStore::WaitForOtherThreads will not wait for it
+            pThread->SetBackground(TRUE);
+
+            EX_TRY
+            {
+                GCX_PREEMP();
+
+                pWorker->Run();
+            }
+            EX_CATCH
+            {
+            }
+            EX_END_CATCH(SwallowAllExceptions);
+        }
+
+        if (pThread != NULL)
+        {
+            DestroyThread(pThread);
+        }
+
+        // Once started, the thread owns the worker.
+        delete pWorker;
+    }
+
+    END_ENTRYPOINT_NOTHROW;
+
+    return 0;
+}
+
+
+void AutoStartEagerTypeLoad()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    CLRConfigStringHolder wszList(CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EagerTypeLoadList));
+
+    if ((wszList == NULL) || (wszList[0] == 0))
+    {
+        return;
+    }
+
+    NewHolder<EagerTypeLoadWorker> pWorker(new (nothrow) EagerTypeLoadWorker());
+
+    if (pWorker == NULL)
+    {
+        return;
+    }
+
+    if (FAILED(pWorker->ReadManifest(wszList)))
+    {
+        return;
+    }
+
+    if (SUCCEEDED(pWorker->Start()))
+    {
+        // The background thread deletes the worker when it is done with it.
+        pWorker.SuppressRelease();
+    }
+}
+
+
 // ---------------------------------------------------------------------------
 // %%Function: ForceEEShutdown()
 //
@@ -1296,6 +1627,15 @@ void STDMETHODCALLTYPE EEShutDownHelper(BOOL fIsDllUnloading)
         // Indicate the EE is the shut down phase.
         g_fEEShutDown |= ShutDown_Start;
 
+#ifdef _DEBUG
+        // Re-run the cache line audit report now that lazily initialized
+        // components (e.g. the threadpool) have registered their entries.
+        if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_AuditCacheLines) != 0)
+        {
+            CacheLineAuditReport();
+        }
+#endif // _DEBUG
+
         // Terminate the BBSweep thread
         g_BBSweep.ShutdownBBSweepThread();
 
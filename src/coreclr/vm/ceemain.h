@@ -21,6 +21,10 @@ class EEDbgInterfaceImpl;
 // Ensure the EE is started up.
 HRESULT EnsureEEStarted();
 
+// If EagerTypeLoadList is configured, kick off a background thread that loads
+// the listed types before the application's first touch of them.
+void AutoStartEagerTypeLoad();
+
 // Enum to control what happens at the end of EE shutdown. There are two options:
 // 1. Call ::ExitProcess to cause the process to terminate gracefully. This is how
 //    shutdown normally ends. "Shutdown" methods that take this action as an argument
@@ -1189,6 +1189,10 @@ EEJitManager::EEJitManager()
 #endif
 
     m_cleanupList = NULL;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    m_fSegregateHotCodeHeaps = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TC_SegregateHotCodeHeaps) != 0);
+#endif
 }
 
 #if defined(TARGET_X86) || defined(TARGET_AMD64)
@@ -2278,6 +2282,7 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
     pHp->endAddress      = pHp->startAddress;
     pHp->maxCodeHeapSize = heapSize;
     pHp->reserveForJumpStubs = fAllocatedFromEmergencyJumpStubReserve ? pHp->maxCodeHeapSize : GetDefaultReserveForJumpStubs(pHp->maxCodeHeapSize);
+    pHp->fHotCode        = pInfo->IsHotCode();
 
     _ASSERTE(heapSize >= initialRequestSize);
 
@@ -2335,6 +2340,7 @@ void CodeHeapRequestInfo::Init()
         m_pAllocator = m_pMD->GetLoaderAllocator();
     m_isDynamicDomain = (m_pMD != NULL) && m_pMD->IsLCGMethod();
     m_isCollectible = m_pAllocator->IsCollectible();
+    m_isHotCode = false;
     m_throwOnOutOfMemoryWithinRange = true;
 }
 
@@ -2516,6 +2522,11 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap;
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = NULL;
     }
+    else if (pInfo->IsHotCode())
+    {
+        pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedHotCodeHeap;
+        pInfo->m_pAllocator->m_pLastUsedHotCodeHeap = NULL;
+    }
     else
     {
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedCodeHeap;
@@ -2576,6 +2587,10 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     {
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = pCodeHeap;
     }
+    else if (pInfo->IsHotCode())
+    {
+        pInfo->m_pAllocator->m_pLastUsedHotCodeHeap = pCodeHeap;
+    }
     else
     {
         pInfo->m_pAllocator->m_pLastUsedCodeHeap = pCodeHeap;
@@ -2595,7 +2610,8 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     RETURN(mem);
 }
 
-void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool fHotCode,
+                             CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                              size_t* pAllocatedSize, HeapList** ppCodeHeap
 #ifdef USE_INDIRECT_CODEHEADER
                            , BYTE** ppRealHeader
@@ -2649,6 +2665,14 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
     {
         requestInfo.SetDynamicDomain();
     }
+#endif
+#ifdef FEATURE_TIERED_COMPILATION
+    // Keep optimized bodies on their own heaps so that a method promoted to tier-1 lands
+    // next to other hot code rather than in the middle of superseded tier-0 bodies.
+    if (fHotCode && m_fSegregateHotCodeHeaps && !requestInfo.IsDynamicDomain())
+    {
+        requestInfo.SetHotCode();
+    }
 #endif
     requestInfo.setReserveForJumpStubs(reserveForJumpStubs);
 
@@ -2786,6 +2810,14 @@ bool EEJitManager::CanUseCodeHeap(CodeHeapRequestInfo *pInfo, HeapList *pCodeHea
 
     if ((pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0))
     {
+        // Hot (tier-1) and cold code are never mixed on the same heap; that is the point
+        // of the segregation. Range-constrained requests (jump stubs) are exempt since
+        // they may only be satisfiable from the reserve of a particular heap.
+        if (pCodeHeap->fHotCode != pInfo->IsHotCode())
+        {
+            return false;
+        }
+
         // We have no constraint so this non empty heap will be able to satisfy our request
         if (pInfo->IsDynamicDomain())
         {
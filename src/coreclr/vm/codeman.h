@@ -369,6 +369,7 @@ struct CodeHeapRequestInfo
     size_t       m_reserveForJumpStubs; // Amount to reserve for jump stubs (won't be allocated)
     bool         m_isDynamicDomain;
     bool         m_isCollectible;
+    bool         m_isHotCode;
     bool         m_throwOnOutOfMemoryWithinRange;
 
     bool   IsDynamicDomain()                    { return m_isDynamicDomain;    }
@@ -376,6 +377,9 @@ struct CodeHeapRequestInfo
 
     bool   IsCollectible()                      { return m_isCollectible;      }
 
+    bool   IsHotCode()                          { return m_isHotCode;          }
+    void   SetHotCode()                         { m_isHotCode = true;          }
+
     size_t getRequestSize()                     { return m_requestSize;        }
     void   setRequestSize(size_t requestSize)   { m_requestSize = requestSize; }
 
@@ -478,6 +482,8 @@ struct HeapList
     size_t              maxCodeHeapSize;// Size of the entire contiguous block of memory
     size_t              reserveForJumpStubs; // Amount of memory reserved for jump stubs in this block
 
+    bool                fHotCode;       // this heap only serves tier-1 (optimized) method bodies
+
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64)
     BYTE*               CLRPersonalityRoutine;  // jump thunk to personality routine
 #endif
@@ -974,7 +980,8 @@ public:
 
     BOOL                LoadJIT();
 
-    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool fHotCode,
+                                  CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                                   size_t* pAllocatedSize, HeapList** ppCodeHeap
 #ifdef USE_INDIRECT_CODEHEADER
                                 , BYTE** ppRealHeader
@@ -1127,6 +1134,9 @@ public:
 
 private :
     PTR_HostCodeHeap    m_cleanupList;
+#ifdef FEATURE_TIERED_COMPILATION
+    bool                m_fSegregateHotCodeHeaps; // cached COMPlus_TC_SegregateHotCodeHeaps setting
+#endif
     //When EH Clauses are resolved we need to atomically update the TypeHandle
     Crst                m_JitLoadCritSec;
 
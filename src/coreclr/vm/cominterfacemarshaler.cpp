@@ -316,7 +316,12 @@ OBJECTREF COMInterfaceMarshaler::FindOrCreateObjectRefInternal(IUnknown **ppInco
     // (I)
     // Initial check in our cache
     // Skip if we want a unique object.
-    if (!NeedUniqueObject())
+    // Probe the cache without the lock first - lookups in the RCW cache are
+    // lock-free. If this identity has never been wrapped (the common case when
+    // objects are marshaled in for the first time), we skip the lock entirely.
+    // On a hit we take the lock and repeat the lookup under it, since the
+    // wrapper can only be touched while holding the lock.
+    if (!NeedUniqueObject() && m_pWrapperCache->LookupWrapperUnsafe(m_pIdentity) != NULL)
     {
         // Protect oref as SafeAddRef may trigger GC
         GCPROTECT_BEGIN_THREAD(m_pThread, oref);
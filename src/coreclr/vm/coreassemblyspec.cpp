@@ -173,6 +173,27 @@ STDAPI BinderAcquirePEImage(LPCWSTR             wszAssemblyPath,
         PEImageHolder pImage = NULL;
         PEImageHolder pNativeImage = NULL;
 
+        // Probing for files that are not on disk dominates app-path and satellite
+        // probing during startup. Filter those misses with a single attribute query
+        // instead of constructing a PEImage and registering it in the global image
+        // hash only to have TryOpenFile discover that the file does not exist. A
+        // cached image can outlive its file on disk, so the image cache is still
+        // consulted before reporting a miss.
+        if (!bundleFileLocation.IsValid())
+        {
+            ErrorModeHolder mode(SEM_NOOPENFILEERRORBOX|SEM_FAILCRITICALERRORS);
+            if (WszGetFileAttributes(wszAssemblyPath) == INVALID_FILE_ATTRIBUTES &&
+                ((GetLastError() == ERROR_FILE_NOT_FOUND) || (GetLastError() == ERROR_PATH_NOT_FOUND)))
+            {
+                PEImageHolder pCachedImage(PEImage::OpenImage(wszAssemblyPath, MDInternalImport_OnlyLookInCache));
+                if (pCachedImage == NULL)
+                {
+                    hr = HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND);
+                    goto Exit;
+                }
+            }
+        }
+
 #ifdef FEATURE_PREJIT
         // fExplicitBindToNativeImage is set on Phone when we bind to a list of native images and have no IL on device for an assembly
         if (fExplicitBindToNativeImage)
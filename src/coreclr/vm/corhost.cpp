@@ -353,6 +353,8 @@ HRESULT CorHost2::ExecuteAssembly(DWORD dwAppDomainId,
     pCurDomain->GetMulticoreJitManager().AutoStartProfile(pCurDomain);
 #endif // defined(FEATURE_MULTICOREJIT)
 
+    AutoStartEagerTypeLoad();
+
     {
         GCX_COOP();
 
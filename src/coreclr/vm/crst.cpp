@@ -36,6 +36,7 @@
 
 #ifndef DACCESS_COMPILE
 Volatile<LONG> g_ShutdownCrstUsageCount = 0;
+Volatile<LONGLONG> g_CrstContentionCount = 0;
 
 //-----------------------------------------------------------------
 // Initialize critical section
@@ -280,11 +281,6 @@ void CrstBase::Enter(INDEBUG(NoLevelCheckFlag noLevelCheckFlag/* = CRST_LEVEL_CH
 
     _ASSERTE(IsCrstInitialized());
 
-    // Is Critical Section entered?
-    // We could have perhaps used m_criticalsection.LockCount, but
-    // while spinning, we want to fire the ETW event only once
-    BOOL fIsCriticalSectionEnteredAfterFailingOnce = FALSE;
-
     Thread * pThread;
     BOOL fToggle;
 
@@ -319,7 +315,41 @@ void CrstBase::Enter(INDEBUG(NoLevelCheckFlag noLevelCheckFlag/* = CRST_LEVEL_CH
         }
     }
 
-    EnterCriticalSection(&m_criticalsection);
+    if (!TryEnterCriticalSection(&m_criticalsection))
+    {
+        // Somebody else holds the lock and we are about to wait for it. Count
+        // the contention exactly once per blocking acquisition, up front, so
+        // the cost stays fixed no matter how long the wait turns out to be.
+        // Uncontended acquisitions take only the TryEnter above and pay
+        // nothing extra.
+        InterlockedIncrement64((LONGLONG *)&g_CrstContentionCount);
+
+        // When a listener asks for the contention keyword, time the wait and
+        // report it the same way monitor contention is reported, just flagged
+        // as native. The event write below goes through per-thread buffers
+        // and spin locks only, so it cannot reenter a Crst. Stack attribution
+        // comes from the tracing session's own stack collection; nothing here
+        // needs to walk the stack.
+        BOOLEAN fContentionKeywordEnabled = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_CONTENTION_KEYWORD);
+        LARGE_INTEGER startTicks = { {0} };
+
+        if (fContentionKeywordEnabled)
+        {
+            QueryPerformanceCounter(&startTicks);
+            FireEtwContentionStart_V1(ETW::ContentionLog::ContentionStructs::NativeContention, GetClrInstanceId());
+        }
+
+        EnterCriticalSection(&m_criticalsection);
+
+        if (fContentionKeywordEnabled)
+        {
+            LARGE_INTEGER endTicks;
+            QueryPerformanceCounter(&endTicks);
+
+            double elapsedTimeInNanosecond = ComputeElapsedTimeInNanosecond(startTicks, endTicks);
+            FireEtwContentionStop_V1(ETW::ContentionLog::ContentionStructs::NativeContention, GetClrInstanceId(), elapsedTimeInNanosecond);
+        }
+    }
 
 #ifdef _DEBUG
     PostEnter();
@@ -103,6 +103,11 @@ extern DWORD g_fEEShutDown;
 #endif
 // Total count of Crst lock  of the type (Shutdown) that are currently in use
 extern Volatile<LONG> g_ShutdownCrstUsageCount;
+// Total number of times any Crst was already held when a thread tried to enter
+// it. Only the contended path pays for the increment; uncontended acquisitions
+// are not counted and not slowed down. Readable in-proc via
+// CrstBase::GetTotalContentionCount and from dumps via the symbol itself.
+extern Volatile<LONGLONG> g_CrstContentionCount;
 extern Volatile<LONG> g_fForbidEnterEE;
 
 // The CRST.
@@ -282,6 +287,15 @@ public:
 #endif //_DEBUG
     }
 
+    //-----------------------------------------------------------------
+    // Process-wide count of contended Crst acquisitions (all instances).
+    //-----------------------------------------------------------------
+    static LONGLONG GetTotalContentionCount()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return g_CrstContentionCount.Load();
+    }
+
 protected:
 
     VOID InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags);
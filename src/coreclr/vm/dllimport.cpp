@@ -3274,6 +3274,10 @@ BOOL NDirect::MarshalingRequired(
     DWORD dwStackSize = 0;
     CorInfoCallConvExtension callConv = CallConv::GetDefaultUnmanagedCallingConvention();
 
+    // Calli signatures carry no DllImport charset, so assume ANSI and stay conservative
+    // for char arguments unless we have a MethodDesc to consult.
+    CorNativeLinkType nlType = nltAnsi;
+
     if (pMD != NULL)
     {
         // HRESULT swapping is handled by stub
@@ -3323,6 +3327,7 @@ BOOL NDirect::MarshalingRequired(
             return TRUE;
 
         callConv = sigInfo.GetCallConv();
+        nlType = sigInfo.GetCharSet();
     }
 
     if (pSig == NULL)
@@ -3419,13 +3424,29 @@ BOOL NDirect::MarshalingRequired(
             }
 
             case ELEMENT_TYPE_BOOLEAN:
-            case ELEMENT_TYPE_CHAR:
             {
-                // Bool requires marshaling
-                // Char may require marshaling (MARSHAL_TYPE_ANSICHAR)
+                // Bool requires marshaling (the default native representation is a
+                // 4-byte Windows BOOL and the value must be normalized)
                 return TRUE;
             }
 
+            case ELEMENT_TYPE_CHAR:
+            {
+                // Under a Unicode charset, char is passed through unchanged
+                // (MARSHAL_TYPE_GENERIC_U2). An ANSI charset requires narrowing in
+                // the stub, honoring best-fit mapping settings.
+                if (nlType != nltUnicode)
+                    return TRUE;
+
+                if (i > 0)
+                {
+                    const bool isValueType = false;
+                    const bool isFloatHfa = false;
+                    dwStackSize += StackElemSize(CorTypeInfo::Size(type), isValueType, isFloatHfa);
+                }
+                break;
+            }
+
             default:
             {
                 if (CorTypeInfo::IsPrimitiveType(type) || type == ELEMENT_TYPE_FNPTR)
@@ -243,6 +243,7 @@ HRESULT EEConfig::Init()
     fTieredCompilation_QuickJitForLoops = false;
     fTieredCompilation_CallCounting = false;
     fTieredCompilation_UseCallCountingStubs = false;
+    fTieredCompilation_PrioritizeRecentlyPromotedMethods = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_BackgroundWorkerTimeoutMs = 0;
     tieredCompilation_CallCountingDelayMs = 0;
@@ -827,6 +828,9 @@ HRESULT EEConfig::sync()
             }
         }
 
+        fTieredCompilation_PrioritizeRecentlyPromotedMethods =
+            CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_PrioritizeRecentlyPromotedMethods) != 0;
+
         if (fTieredCompilation_CallCounting)
         {
             fTieredCompilation_UseCallCountingStubs =
@@ -87,6 +87,7 @@ public:
     UINT16        TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
     bool          TieredCompilation_UseCallCountingStubs() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_UseCallCountingStubs; }
+    bool          TieredCompilation_PrioritizeRecentlyPromotedMethods() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_PrioritizeRecentlyPromotedMethods; }
     DWORD         TieredCompilation_DeleteCallCountingStubsAfter() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_DeleteCallCountingStubsAfter; }
 #endif
 
@@ -683,6 +684,7 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_QuickJitForLoops;
     bool fTieredCompilation_CallCounting;
     bool fTieredCompilation_UseCallCountingStubs;
+    bool fTieredCompilation_PrioritizeRecentlyPromotedMethods;
     UINT16 tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_BackgroundWorkerTimeoutMs;
     DWORD tieredCompilation_CallCountingDelayMs;
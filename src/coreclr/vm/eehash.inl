@@ -245,7 +245,10 @@ void EEHashTableBase<KeyType, Helper, bDefaultCopyIsDeep>::InsertValue(KeyType p
 
     _ASSERTE(m_pVolatileBucketTable->m_dwNumBuckets != 0);
 
-    if  (m_dwNumEntries > m_pVolatileBucketTable->m_dwNumBuckets*2)
+    // Grow once the load factor reaches one; keeping the average bucket chain at a
+    // single entry trades a little bucket memory for fewer pointer-chasing cache
+    // misses on the lock-free lookup paths.
+    if  (m_dwNumEntries > m_pVolatileBucketTable->m_dwNumBuckets)
     {
         if (!GrowHashTable()) COMPlusThrowOM();
     }
@@ -299,7 +302,10 @@ void EEHashTableBase<KeyType, Helper, bDefaultCopyIsDeep>::InsertKeyAsValue(KeyT
 
     _ASSERTE(m_pVolatileBucketTable->m_dwNumBuckets != 0);
 
-    if  (m_dwNumEntries > m_pVolatileBucketTable->m_dwNumBuckets*2)
+    // Grow once the load factor reaches one; keeping the average bucket chain at a
+    // single entry trades a little bucket memory for fewer pointer-chasing cache
+    // misses on the lock-free lookup paths.
+    if  (m_dwNumEntries > m_pVolatileBucketTable->m_dwNumBuckets)
     {
         if (!GrowHashTable()) COMPlusThrowOM();
     }
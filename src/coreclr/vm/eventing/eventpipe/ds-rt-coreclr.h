@@ -320,6 +320,45 @@ ds_rt_set_environment_variable (const ep_char16_t *name, const ep_char16_t *valu
 	return SetEnvironmentVariableW(reinterpret_cast<LPCWSTR>(name), reinterpret_cast<LPCWSTR>(value)) ? S_OK : HRESULT_FROM_WIN32(GetLastError());
 }
 
+/*
+* StressLog.
+*/
+
+#include "stresslog.h"
+
+static
+uint32_t
+ds_rt_stress_log_collect (
+	uint8_t **buffer,
+	uint32_t *buffer_len)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+#ifdef STRESS_LOG
+	DWORD snapshot_size = 0;
+	BYTE *snapshot = StressLog::CollectSnapshot (&snapshot_size);
+	if (snapshot == NULL)
+		return DS_IPC_E_FAIL;
+
+	*buffer = snapshot;
+	*buffer_len = snapshot_size;
+	return DS_IPC_S_OK;
+#else // STRESS_LOG
+	return DS_IPC_E_NOTSUPPORTED;
+#endif // STRESS_LOG
+}
+
+static
+void
+ds_rt_stress_log_free (uint8_t *buffer)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+#ifdef STRESS_LOG
+	StressLog::FreeSnapshot (buffer);
+#endif // STRESS_LOG
+}
+
 /*
 * DiagnosticServer.
 */
@@ -80,10 +80,12 @@ ep_rt_coreclr_walk_managed_stack_for_thread (
 	// which will cause the GC to try to walk the stack while we are in the middle of walking the stack.
 	bool gc_on_transitions = GC_ON_TRANSITIONS (FALSE);
 
+	// LIGHTUNWIND: sampling only records control PCs, so repeated walks of hot
+	// frames can use the stack walk cache instead of re-decoding unwind info.
 	StackWalkAction result = thread->StackWalkFrames (
 		(PSTACKWALKFRAMESCALLBACK)stack_walk_callback,
 		stack_contents,
-		ALLOW_ASYNC_STACK_WALK | FUNCTIONSONLY | HANDLESKIPPEDFRAMES | ALLOW_INVALID_OBJECTS);
+		ALLOW_ASYNC_STACK_WALK | FUNCTIONSONLY | HANDLESKIPPEDFRAMES | ALLOW_INVALID_OBJECTS | LIGHTUNWIND);
 
 	GC_ON_TRANSITIONS (gc_on_transitions);
 	return ((result == SWA_DONE) || (result == SWA_CONTINUE));
@@ -5382,6 +5382,29 @@ ExceptionTracker* TrackerAllocator::GetTrackerMemory()
 
     _ASSERTE(NULL != m_pFirstPage);
 
+    // Fast path: reuse the tracker this thread freed last.  Exceptions are
+    // thread-affine and rarely nested, so most dispatches are satisfied here
+    // without taking the allocator lock or scanning the pages.  A cached
+    // tracker keeps m_pThread set, so the scan below never hands it out.
+    Thread* pCurThread = GetThread();
+    ExceptionTracker* pCachedTracker = pCurThread->m_pCachedTrackerMemory;
+    if (pCachedTracker != NULL)
+    {
+        pCurThread->m_pCachedTrackerMemory = NULL;
+        _ASSERTE(pCachedTracker->m_pThread == pCurThread);
+
+        // Zero the tracker without ever letting m_pThread read as NULL - the
+        // page scan below runs on other threads and claims any slot whose
+        // owner is NULL.
+        const size_t ofsOwner = offsetof(ExceptionTracker, m_pThread);
+        ZeroMemory(pCachedTracker, ofsOwner);
+        ZeroMemory((BYTE*)pCachedTracker + ofsOwner + sizeof(Thread*),
+                   sizeof(*pCachedTracker) - ofsOwner - sizeof(Thread*));
+
+        EH_LOG((LL_INFO100, "TrackerAllocator: reusing cached tracker 0x%p, thread = 0x%p\n", pCachedTracker, pCurThread));
+        RETURN pCachedTracker;
+    }
+
     Page* pPage = m_pFirstPage;
 
     ExceptionTracker* pTracker = NULL;
@@ -5467,9 +5490,41 @@ void TrackerAllocator::FreeTrackerMemory(ExceptionTracker* pTracker)
     // mark this entry as free
     EH_LOG((LL_INFO100, "TrackerAllocator: freeing tracker 0x%p, thread = 0x%p\n", pTracker, pTracker->m_pThread));
     CONSISTENCY_CHECK(pTracker->IsValid());
+
+    // Keep the tracker reserved for the owning thread's next exception instead
+    // of returning it to the pool; m_pThread stays set so the page scan in
+    // GetTrackerMemory skips it.  The cache is handed back when the Thread
+    // object is destroyed.
+    Thread* pCurThread = GetThreadNULLOk();
+    if ((pCurThread != NULL) &&
+        (pTracker->m_pThread == pCurThread) &&
+        (pCurThread->m_pCachedTrackerMemory == NULL))
+    {
+        pCurThread->m_pCachedTrackerMemory = pTracker;
+        return;
+    }
+
     FastInterlockExchangePointer(&(pTracker->m_pThread), NULL);
 }
 
+void TrackerAllocator::ReleaseCachedTrackerMemory(Thread* pThread)
+{
+    CONTRACTL
+    {
+        GC_NOTRIGGER;
+        NOTHROW;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    ExceptionTracker* pTracker = pThread->m_pCachedTrackerMemory;
+    if (pTracker != NULL)
+    {
+        pThread->m_pCachedTrackerMemory = NULL;
+        FastInterlockExchangePointer(&(pTracker->m_pThread), NULL);
+    }
+}
+
 #ifndef TARGET_UNIX
 // This is Windows specific implementation as it is based upon the notion of collided unwind that is specific
 // to Windows 64bit.
@@ -744,6 +744,7 @@ public:
     void                Terminate();
     ExceptionTracker*   GetTrackerMemory();
     void                FreeTrackerMemory(ExceptionTracker* pTracker);
+    void                ReleaseCachedTrackerMemory(Thread* pThread);
 
 private:
 
@@ -781,6 +782,8 @@ private:
     Crst* m_pCrst;
 };
 
+extern TrackerAllocator g_theTrackerAllocator;
+
 #endif // FEATURE_EH_FUNCLETS
 
 #endif  // __EXCEPTION_HANDLING_h__
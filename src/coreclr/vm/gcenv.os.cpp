@@ -27,6 +27,14 @@
 
 #ifdef TARGET_UNIX
 uint32_t g_pageSizeUnixInl = 0;
+
+// When set, GC heap reservations carry MEM_HUGEPAGES_HINT so the PAL advises
+// the kernel to back them with transparent huge pages.
+static bool g_gcTransparentHugePages = false;
+
+// When set, heaps are mapped to preferred processors (primary SMT threads on
+// performance cores) before the remaining ones.
+static bool g_gcTopologyAwarePlacement = false;
 #endif
 
 static AffinitySet g_processAffinitySet;
@@ -116,6 +124,9 @@ bool GCToOSInterface::Initialize()
 #ifdef TARGET_UNIX
     g_pageSizeUnixInl = GetOsPageSize();
 
+    g_gcTransparentHugePages = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCTransparentHugePages) != 0;
+    g_gcTopologyAwarePlacement = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCTopologyAwarePlacement) != 0;
+
     uint32_t currentProcessCpuCount = PAL_GetLogicalCpuCountFromOS();
     if (PAL_GetCurrentThreadAffinitySet(AffinitySet::BitsetDataSize, g_processAffinitySet.GetBitsetData()))
     {
@@ -332,6 +343,13 @@ void* GCToOSInterface::VirtualReserve(size_t size, size_t alignment, uint32_t fl
 
     DWORD memFlags = (flags & VirtualReserveFlags::WriteWatch) ? (MEM_RESERVE | MEM_WRITE_WATCH) : MEM_RESERVE;
 
+#ifdef TARGET_UNIX
+    if (g_gcTransparentHugePages)
+    {
+        memFlags |= MEM_HUGEPAGES_HINT;
+    }
+#endif
+
     if (node == NUMA_NODE_UNDEFINED)
     {
         // This is not strictly necessary for a correctness standpoint. Windows already guarantees
@@ -1079,10 +1097,42 @@ bool GCToOSInterface::GetProcessorForHeap(uint16_t heap_number, uint16_t* proc_n
     // Locate heap_number-th available processor
     uint16_t procIndex;
     size_t cnt = heap_number;
-    for (uint16_t i = 0; i < MAX_SUPPORTED_CPUS; i++)
+
+#ifdef TARGET_UNIX
+    if (g_gcTopologyAwarePlacement)
     {
-        if (g_processAffinitySet.Contains(i))
+        // Hand out preferred processors (primary SMT threads on performance
+        // cores) first and the remaining ones after that, so that low heap
+        // counts land on full cores instead of hyperthread siblings or
+        // efficiency cores. On machines without SMT or hybrid cores every
+        // processor is preferred and this degenerates to the plain walk below.
+        size_t preferredCount = 0;
+        for (uint16_t i = 0; i < MAX_SUPPORTED_CPUS; i++)
+        {
+            if (g_processAffinitySet.Contains(i) && PAL_IsPreferredProcessor(i))
+            {
+                preferredCount++;
+            }
+        }
+
+        bool preferredPass = cnt < preferredCount;
+        if (!preferredPass)
+        {
+            cnt -= preferredCount;
+        }
+
+        for (uint16_t i = 0; i < MAX_SUPPORTED_CPUS; i++)
         {
+            if (!g_processAffinitySet.Contains(i))
+            {
+                continue;
+            }
+
+            if ((PAL_IsPreferredProcessor(i) != FALSE) != preferredPass)
+            {
+                continue;
+            }
+
             if (cnt == 0)
             {
                 procIndex = i;
@@ -1093,6 +1143,24 @@ bool GCToOSInterface::GetProcessorForHeap(uint16_t heap_number, uint16_t* proc_n
             cnt--;
         }
     }
+    else
+#endif // TARGET_UNIX
+    {
+        for (uint16_t i = 0; i < MAX_SUPPORTED_CPUS; i++)
+        {
+            if (g_processAffinitySet.Contains(i))
+            {
+                if (cnt == 0)
+                {
+                    procIndex = i;
+                    success = true;
+                    break;
+                }
+
+                cnt--;
+            }
+        }
+    }
 
     if (success)
     {
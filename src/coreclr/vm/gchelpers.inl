@@ -71,8 +71,34 @@ FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
     BYTE* card = (BYTE*)VolatileLoadWithoutBarrier(&g_card_table) + startingClump;
 
     // Fill the cards. To avoid cache line thrashing we check whether the cards have already been set before
-    // writing.
-    do
+    // writing. Large copies can cover thousands of clumps, so once the card pointer is aligned we check and
+    // set a pointer-sized group of cards at a time.
+    if (clumpCount >= 2 * sizeof(size_t))
+    {
+        while (((size_t)card & (sizeof(size_t) - 1)) != 0)
+        {
+            if (*card != 0xff)
+            {
+                *card = 0xff;
+            }
+
+            card++;
+            clumpCount--;
+        }
+
+        while (clumpCount >= sizeof(size_t))
+        {
+            if (*(size_t*)card != (size_t)-1)
+            {
+                *(size_t*)card = (size_t)-1;
+            }
+
+            card += sizeof(size_t);
+            clumpCount -= sizeof(size_t);
+        }
+    }
+
+    while (clumpCount != 0)
     {
         if (*card != 0xff)
         {
@@ -82,7 +108,6 @@ FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
         card++;
         clumpCount--;
     }
-    while (clumpCount != 0);
 
 #ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
     size_t startBundleByte = startAddress >> card_bundle_byte_shift;
@@ -568,14 +568,12 @@ ILStubCache::ILStubCacheTraits::count_t ILStubCache::ILStubCacheTraits::Hash(_In
     LIMITED_METHOD_CONTRACT;
 
     size_t cb = key->m_cbSizeOfBlob - sizeof(ILStubHashBlobBase);
-    int   hash = 0;
 
-    for (size_t i = 0; i < cb; i++)
-    {
-        hash = _rotl(hash, 1) + key->m_rgbBlobData[i];
-    }
-
-    return hash;
+    // Use the standard byte hash rather than a rotate-by-1 sum: hash blobs are
+    // near-permutations of each other (same param attributes and sig bytes in
+    // slightly different order), and a circular sum collapses those to the same
+    // bucket, turning lookups into memcmp chains under the cache lock.
+    return HashBytes(key->m_rgbBlobData, cb);
 }
 
 bool ILStubCache::ILStubCacheTraits::Equals(_In_ key_t lhs, _In_ key_t rhs)
@@ -1640,6 +1640,15 @@ void Interpreter::JitMethodIfAppropriate(InterpreterMethodInfo* interpMethInfo,
 
     if (force || interpMethInfo->m_invocations > MaxInterpretCount)
     {
+        // Ask for the promotion only once. Until the background JIT publishes its code the
+        // method keeps being interpreted, and there is no point re-taking the code version
+        // manager lock on every one of those calls just to rediscover the pending request.
+        if (!force && interpMethInfo->GetFlag<InterpreterMethodInfo::Flag_jitPromotionRequested>())
+        {
+            return;
+        }
+        interpMethInfo->SetFlag<InterpreterMethodInfo::Flag_jitPromotionRequested>(true);
+
         GCX_PREEMP();
         MethodDesc *md = reinterpret_cast<MethodDesc *>(interpMethInfo->m_method);
         PCODE stub = md->GetNativeCode();
@@ -600,6 +600,8 @@ struct InterpreterMethodInfo
         // We recognize two forms of dead simple getters, one for "opt" and one for "dbg".  If it is
         // dead simple, is it dbg or opt?
         Flag_methIsDeadSimpleGetterIsDbgForm,
+        // Has JitMethodIfAppropriate already requested promotion of this method to the JIT?
+        Flag_jitPromotionRequested,
         Flag_Count,
     };
 
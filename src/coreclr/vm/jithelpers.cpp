@@ -1774,6 +1774,21 @@ HCIMPL1(void*, JIT_GetGCThreadStaticBase_Helper, MethodTable * pMT)
 HCIMPLEND
 
 
+// Per-thread single-entry cache for the most recently resolved non-GC thread static
+// base. The full resolution walks Thread -> ThreadLocalBlock -> TLM table -> class
+// init bitmap on every access; a hit here short-circuits all of that to one compare.
+// Only non-collectible modules are cached: their DomainLocalModule and the thread's
+// precomputed statics block are never freed, so neither the key nor the cached base
+// pointer can go stale. (The GC statics base is not cached anywhere since it points
+// into the GC heap and can move.)
+struct ThreadStaticNonGCBaseCache
+{
+    DomainLocalModule * pDomainLocalModule;
+    DWORD               dwClassDomainID;
+    void *              pNonGCBase;
+};
+static thread_local ThreadStaticNonGCBaseCache t_threadStaticNonGCBaseCache;
+
 // *** This helper corresponds to both CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE and
 //     CORINFO_HELP_GETSHARED_NONGCTHREADSTATIC_BASE_NOCTOR. Even though we always check
 //     if the class constructor has been run, we have a separate helper ID for the "no ctor"
@@ -1785,6 +1800,13 @@ HCIMPL2(void*, JIT_GetSharedNonGCThreadStaticBase, DomainLocalModule *pDomainLoc
 {
     FCALL_CONTRACT;
 
+    // Check the per-thread cache first.
+    if ((t_threadStaticNonGCBaseCache.pDomainLocalModule == pDomainLocalModule) &&
+        (t_threadStaticNonGCBaseCache.dwClassDomainID == dwClassDomainID))
+    {
+        return t_threadStaticNonGCBaseCache.pNonGCBase;
+    }
+
     // Get the ModuleIndex
     ModuleIndex index = pDomainLocalModule->GetModuleIndex();
 
@@ -1794,7 +1816,20 @@ HCIMPL2(void*, JIT_GetSharedNonGCThreadStaticBase, DomainLocalModule *pDomainLoc
     // If the TLM has been allocated and the class has been marked as initialized,
     // get the pointer to the non-GC statics base and return
     if (pThreadLocalModule != NULL && pThreadLocalModule->IsPrecomputedClassInitialized(dwClassDomainID))
-        return (void*)pThreadLocalModule->GetPrecomputedNonGCStaticsBasePointer();
+    {
+        void* pNonGCBase = (void*)pThreadLocalModule->GetPrecomputedNonGCStaticsBasePointer();
+
+        // A collectible module's statics can be freed while the thread lives, so only
+        // remember bases whose lifetime matches the thread's.
+        if (!pDomainLocalModule->GetDomainFile()->GetModule()->IsCollectible())
+        {
+            t_threadStaticNonGCBaseCache.pDomainLocalModule = pDomainLocalModule;
+            t_threadStaticNonGCBaseCache.dwClassDomainID = dwClassDomainID;
+            t_threadStaticNonGCBaseCache.pNonGCBase = pNonGCBase;
+        }
+
+        return pNonGCBase;
+    }
 
     // If the TLM was not allocated or if the class was not marked as initialized
     // then we have to go through the slow path
@@ -3238,6 +3273,16 @@ CORINFO_GENERIC_HANDLE JIT_GenericHandleWorker(MethodDesc * pMD, MethodTable * p
         // inherited types are faster next time rather than just just for this specific pMT.
         JitGenericHandleCacheKey key((CORINFO_CLASS_HANDLE)pDeclaringMT, (CORINFO_METHOD_HANDLE)pMD, signature, pDictDomain);
         AddToGenericHandleCache(&key, (HashDatum)result);
+
+        if (pMT != NULL && pDeclaringMT != pMT)
+        {
+            // The fast helpers key their cache lookups off the derived type, so also add the
+            // denormalized key now. Otherwise the first lookup from this type would miss and
+            // take another trip through the framed helper just to copy the entry over. This is
+            // not a critical entry - no need to specify appdomain affinity.
+            JitGenericHandleCacheKey denormKey((CORINFO_CLASS_HANDLE)pMT, NULL, signature);
+            AddToGenericHandleCache(&denormKey, (HashDatum)result);
+        }
     }
 
     if (pMT != NULL && pDeclaringMT != pMT)
@@ -3665,7 +3710,42 @@ NOINLINE static void JIT_MonEnter_Helper(Object* obj, BYTE* pbLockTaken, LPVOID
     {
         GET_THREAD()->PulseGCMode();
     }
-    objRef->EnterObjMonitor();
+
+    // A thin lock that is still contended once the inline spin above gives up gets
+    // inflated to a sync block with an OS event and stays heavyweight for the life of
+    // the object. Short contention bursts do not justify that, so retry the thin-lock
+    // fast path a few more times with a thread yield between attempts before
+    // inflating. Blocking without inflating is not possible - the event a waiter
+    // parks on lives in the sync block - so persistent contention still falls
+    // through to the inflating path below.
+    bool bEntered = false;
+    if ((objRef->GetHeader()->GetBits() & BIT_SBLK_IS_HASH_OR_SYNCBLKINDEX) == 0)
+    {
+        DWORD dwSwitchCount = 0;
+        for (DWORD dwRetry = 0; dwRetry < g_SpinConstants.dwRepetitions; dwRetry++)
+        {
+            {
+                GCX_PREEMP();
+                __SwitchToThread(0, ++dwSwitchCount);
+            }
+
+            AwareLock::EnterHelperResult result = objRef->EnterObjMonitorHelper(GET_THREAD());
+            if (result == AwareLock::EnterHelperResult_Entered)
+            {
+                bEntered = true;
+                break;
+            }
+            if (result == AwareLock::EnterHelperResult_UseSlowPath)
+            {
+                break;
+            }
+        }
+    }
+
+    if (!bEntered)
+    {
+        objRef->EnterObjMonitor();
+    }
 
     if (pbLockTaken != 0) *pbLockTaken = 1;
 
@@ -5208,10 +5288,23 @@ void JIT_Patchpoint(int* counter, int ilOffset)
     // method sees the "expected" SP misalgnment on entry.
     _ASSERTE(currentSP % 16 == 0);
     currentSP -= 8;
-#endif
 
     SetSP(&frameContext, currentSP);
     frameContext.Rbp = currentFP;
+#elif defined(TARGET_ARM64)
+    // No return address is pushed by calls on arm64. The OSR method must be entered
+    // with LR holding the return address into the original method's caller, since its
+    // prolog will save LR/FP just like a normally invoked method would.
+    //
+    // At this point frameContext describes the original method's caller, so its IP is
+    // exactly that return address.
+    SetSP(&frameContext, currentSP);
+    SetFP(&frameContext, currentFP);
+    SetLR(&frameContext, GetIP(&frameContext));
+#else
+    // Transition is not implemented for this target.
+    EEPOLICY_HANDLE_FATAL_ERROR(COR_E_EXECUTIONENGINE);
+#endif
 
     // Note we can get here w/o triggering, if there is an existing OSR method and
     // we hit the patchpoint.
@@ -5372,6 +5465,69 @@ HCIMPL2(void, JIT_ClassProfile64, Object *obj, void* tableAddress)
 }
 HCIMPLEND
 
+// Counters for blocks and edges beyond this power of two are updated
+// probabilistically, trading exactness of hot counts for cache coherence
+// traffic. Hot counts remain accurate in expectation.
+static const DWORD COUNT_PROFILE_THRESHOLD_LOG2 = 13;
+
+HCIMPL1(void, JIT_CountProfile32, volatile LONG* pCounter)
+{
+    FCALL_CONTRACT;
+    FC_GC_POLL_NOT_NEEDED();
+
+    LONG count = *pCounter;
+    LONG delta = 1;
+
+    if (count > 0)
+    {
+        DWORD logCount;
+        BitScanReverse(&logCount, count);
+
+        if (logCount >= COUNT_PROFILE_THRESHOLD_LOG2)
+        {
+            delta = 1 << (logCount - (COUNT_PROFILE_THRESHOLD_LOG2 - 1));
+            const unsigned rand = ClassProfileRand();
+            const bool update = (rand & (delta - 1)) == 0;
+            if (!update)
+            {
+                return;
+            }
+        }
+    }
+
+    InterlockedExchangeAdd(pCounter, delta);
+}
+HCIMPLEND
+
+HCIMPL1(void, JIT_CountProfile64, volatile LONG64* pCounter)
+{
+    FCALL_CONTRACT;
+    FC_GC_POLL_NOT_NEEDED();
+
+    LONG64 count = *pCounter;
+    LONG64 delta = 1;
+
+    if (count > 0)
+    {
+        DWORD logCount;
+        BitScanReverse64(&logCount, count);
+
+        if (logCount >= COUNT_PROFILE_THRESHOLD_LOG2)
+        {
+            delta = (LONG64)1 << (logCount - (COUNT_PROFILE_THRESHOLD_LOG2 - 1));
+            const unsigned rand = ClassProfileRand();
+            const bool update = (rand & (delta - 1)) == 0;
+            if (!update)
+            {
+                return;
+            }
+        }
+    }
+
+    InterlockedExchangeAdd64(pCounter, delta);
+}
+HCIMPLEND
+
 //========================================================================
 //
 //      INTEROP HELPERS
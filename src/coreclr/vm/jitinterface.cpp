@@ -8062,7 +8062,16 @@ CorInfoInline CEEInfo::canInline (CORINFO_METHOD_HANDLE hCaller,
             else
             {
 #ifdef FEATURE_READYTORUN_COMPILER
-                // No inlinining for version resilient code except if in the same version bubble
+                // No inlinining for version resilient code except if in the same version bubble.
+                //
+                // A multi-module bubble is declared at compile time (--largeversionbubble /
+                // NGENWORKER_FLAGS_LARGEVERSIONBUBBLE); within it cross-module inlines are
+                // permitted here and every successful inline is recorded through
+                // ReportInlining into the image's InliningInfo section, so servicing can
+                // find all methods that embedded a changed inlinee. At runtime, bubble
+                // membership of the loaded modules is validated by
+                // Module::IsInSameVersionBubble and the composite MVID checks.
+                //
                 // If this condition changes, please make the corresponding change
                 // in getCallInfo, too.
                 if (IsReadyToRunCompilation() &&
@@ -12349,7 +12358,11 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
             pArgs->hotCodeSize + pArgs->coldCodeSize, pArgs->roDataSize, totalSize.Value(), pArgs->flag, GetClrInstanceId());
     }
 
-    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
+    // Tier-1 bodies are what the process ends up executing in steady state; let the code
+    // heap keep them together instead of interleaving them with tier-0 code.
+    bool fHotCode = m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1);
+
+    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, fHotCode, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
 #ifdef USE_INDIRECT_CODEHEADER
                           , &m_pRealCodeHeader
 #endif
@@ -70,6 +70,7 @@ LoaderAllocator::LoaderAllocator()
     m_pCodeHeapInitialAlloc = NULL;
     m_pVSDHeapInitialAlloc = NULL;
     m_pLastUsedCodeHeap = NULL;
+    m_pLastUsedHotCodeHeap = NULL;
     m_pLastUsedDynamicCodeHeap = NULL;
     m_pJumpStubCache = NULL;
     m_IsCollectible = false;
@@ -579,7 +580,9 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
         pFirstDestroyedLoaderAllocator = pOriginalLoaderAllocator;
     }
 
-    // Iterate through free list, deleting DomainAssemblies
+    // Iterate through free list, deleting DomainAssemblies. This pass performs all the cleanup that can
+    // run with the EE live so the suspension below covers only the work that truly requires stopped
+    // threads.
     pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
     while (pDomainLoaderAllocatorDestroyIterator != NULL)
     {
@@ -597,17 +600,24 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
 
         pDomainLoaderAllocatorDestroyIterator->ReleaseManagedAssemblyLoadContext();
 
-        // The following code was previously happening on delete ~DomainAssembly->Terminate
-        // We are moving this part here in order to make sure that we can unload a LoaderAllocator
-        // that didn't have a DomainAssembly
-        // (we have now a LoaderAllocator with 0-n DomainAssembly)
+        pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+    }
+
+    // The following code was previously happening on delete ~DomainAssembly->Terminate
+    // We are moving this part here in order to make sure that we can unload a LoaderAllocator
+    // that didn't have a DomainAssembly
+    // (we have now a LoaderAllocator with 0-n DomainAssembly)
 
-        // This cleanup code starts resembling parts of AppDomain::Terminate too much.
-        // It would be useful to reduce duplication and also establish clear responsibilites
-        // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
-        // and LoaderAllocator::~LoaderAllocator. We need to establish how these
-        // cleanup paths interact with app-domain unload and process tear-down, too.
+    // This cleanup code starts resembling parts of AppDomain::Terminate too much.
+    // It would be useful to reduce duplication and also establish clear responsibilites
+    // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
+    // and LoaderAllocator::~LoaderAllocator. We need to establish how these
+    // cleanup paths interact with app-domain unload and process tear-down, too.
 
+    {
+        // Suspend the EE once for the whole batch rather than per LoaderAllocator; each suspension is a
+        // mutator-visible pause, and the global cache clears below only need to happen once per batch
+        // anyway.
         if (!IsAtProcessExit())
         {
             // Suspend the EE to do some clean up that can only occur
@@ -622,10 +632,15 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             CastCache::FlushCurrentCache();
         }
 
-        ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
-        pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+        pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+        while (pDomainLoaderAllocatorDestroyIterator != NULL)
+        {
+            ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
+            pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+
+            pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+        }
 
-        // TODO: Do we really want to perform this on each LoaderAllocator?
         MethodTable::ClearMethodDataCache();
         ClearJitGenericHandleCache(pAppDomain);
 
@@ -634,7 +649,11 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             // Resume the EE.
             ThreadSuspend::RestartEE(FALSE, TRUE);
         }
+    }
 
+    pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+    while (pDomainLoaderAllocatorDestroyIterator != NULL)
+    {
         // Because RegisterLoaderAllocatorForDeletion is modifying m_pLoaderAllocatorDestroyNext, we are saving it here
         LoaderAllocator* pLoaderAllocatorDestroyNext = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
 
@@ -1312,6 +1331,37 @@ BYTE *LoaderAllocator::GetCodeHeapInitialBlock(const BYTE * loAddr, const BYTE *
     return buffer;
 }
 
+void LoaderAllocator::TrimHeaps()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    } CONTRACTL_END;
+
+    // In collectible types the low frequency and high frequency heaps are merged,
+    // so don't trim the same heap twice.
+    if ((m_pLowFrequencyHeap != NULL) && (m_pLowFrequencyHeap != m_pHighFrequencyHeap))
+    {
+        m_pLowFrequencyHeap->Trim();
+    }
+
+    if (m_pHighFrequencyHeap != NULL)
+    {
+        m_pHighFrequencyHeap->Trim();
+    }
+
+    if (m_pStubHeap != NULL)
+    {
+        m_pStubHeap->Trim();
+    }
+
+    if (m_pExecutableHeap != NULL)
+    {
+        m_pExecutableHeap->Trim();
+    }
+}
+
 // in retail should be called from AppDomain::Terminate
 void LoaderAllocator::Terminate()
 {
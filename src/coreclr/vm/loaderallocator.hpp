@@ -206,6 +206,7 @@ public:
 
     // ExecutionManager caches
     void * m_pLastUsedCodeHeap;
+    void * m_pLastUsedHotCodeHeap;
     void * m_pLastUsedDynamicCodeHeap;
     void * m_pJumpStubCache;
 
@@ -551,6 +552,10 @@ public:
     void Terminate();
     virtual void ReleaseManagedAssemblyLoadContext() {}
 
+    // Return committed-but-unused loader heap pages to the OS. Intended for long-lived
+    // allocators after a burst of loading; the pages are recommitted on demand.
+    void TrimHeaps();
+
     SIZE_T EstimateSize();
 
     void SetupManagedTracking(LOADERALLOCATORREF *pLoaderAllocatorKeepAlive);
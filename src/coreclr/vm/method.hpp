@@ -717,6 +717,13 @@ public:
     inline void SetNotInline(BOOL set)
     {
         WRAPPER_NO_CONTRACT;
+
+        // Popular non-inlinable methods get this hint reported by every caller that tries to
+        // inline them. Skip the interlocked update (and the write to the MethodDesc's page)
+        // when the flag already has the requested value.
+        if (!IsNotInline() == !set)
+            return;
+
         InterlockedUpdateFlags(mdcNotInline, set);
     }
 
@@ -10027,16 +10027,9 @@ MethodTable * MethodTableBuilder::AllocateNewMT(
     cbTotalSize += S_SIZE_T(fHasDynamicInterfaceMap ? sizeof(DWORD_PTR) : 0);
 #endif
 
-    // Dictionary pointers start here
-    S_SIZE_T offsetOfInstAndDict = cbTotalSize;
-
-    if (dwNumDicts != 0)
-    {
-        cbTotalSize += sizeof(GenericsDictInfo);
-        cbTotalSize += S_SIZE_T(dwNumDicts) * S_SIZE_T(sizeof(MethodTable::PerInstInfoElem_t));
-        cbTotalSize += cbInstAndDict;
-    }
-
+    // Unshared vtable chunks are placed right after the interface map so that the
+    // data consulted by virtual and interface dispatch stays packed near the front
+    // of the allocation; the more rarely touched generic dictionaries follow.
     S_SIZE_T offsetOfUnsharedVtableChunks = cbTotalSize;
 
     BOOL canShareVtableChunks = pMTParent && MethodTable::CanShareVtableChunksFrom(pMTParent, pLoaderModule
@@ -10068,6 +10061,16 @@ MethodTable * MethodTableBuilder::AllocateNewMT(
         }
     }
 
+    // Dictionary pointers start here
+    S_SIZE_T offsetOfInstAndDict = cbTotalSize;
+
+    if (dwNumDicts != 0)
+    {
+        cbTotalSize += sizeof(GenericsDictInfo);
+        cbTotalSize += S_SIZE_T(dwNumDicts) * S_SIZE_T(sizeof(MethodTable::PerInstInfoElem_t));
+        cbTotalSize += cbInstAndDict;
+    }
+
     // Add space for the non-virtual slots array (pointed to by an optional member) if required
     // If there is only one non-virtual slot, we store it directly in the optional member and need no array
     S_SIZE_T offsetOfNonVirtualSlots = cbTotalSize;
@@ -10187,7 +10190,7 @@ MethodTable * MethodTableBuilder::AllocateNewMT(
         }
     }
 
-    // the dictionary pointers follow the interface map
+    // the dictionary pointers follow the unshared vtable chunks
     if (dwNumDicts)
     {
         MethodTable::PerInstInfoElem_t *pPerInstInfo = (MethodTable::PerInstInfoElem_t *)(pData + offsetOfInstAndDict.Value() + sizeof(GenericsDictInfo));
@@ -43,6 +43,9 @@ const int      HEADER_D_COUNTER  = 3;               // Extra 32-bit counters in
 const int      MULTICOREJITLIFE  = 60 * 1000;       // 60 seconds
 const int      MAX_WALKBACK      = 128;
 
+const unsigned MAX_DEFERRED_METHODS    = 512;       // Maximum number of method records kept for deferred replay
+const int      DEFERRED_RETRY_PERIOD   = 50;        // Milliseconds between deferred replay passes
+
 enum
 {
     MULTICOREJIT_PROFILE_VERSION   = 102,
@@ -295,6 +298,23 @@ private:
     unsigned                           m_moduleCount;
     PlayerModuleInfo                 * m_pModules;
 
+    // Method record whose module was not loaded yet when the record was first visited.
+    // Instead of dropping such methods, they are replayed after the main profile pass
+    // once the application loads the module.
+    struct DeferredMethodRecord
+    {
+        unsigned     moduleIndex;
+        unsigned     token;            // method token; 0 for generic methods
+        const BYTE * pSignature;       // binary signature in m_pFileBuffer; generic methods only
+        unsigned     signatureLength;
+    };
+
+    DeferredMethodRecord             * m_pDeferredMethods;
+    unsigned                           m_nDeferredMethodCount;
+
+    void DeferMethodRecord(unsigned moduleIndex, unsigned token, const BYTE * pSignature, unsigned signatureLength);
+    HRESULT PlayDeferredMethodRecords();
+
     HRESULT HandleModuleRecord(const ModuleRecord * pMod);
     HRESULT HandleModuleInfoRecord(unsigned moduleTo, unsigned level);
     HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token);
@@ -389,6 +389,9 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(ICLRPrivBinder * pBinderCon
     m_pFileBuffer        = NULL;
     m_nFileSize          = 0;
 
+    m_pDeferredMethods       = NULL;
+    m_nDeferredMethodCount   = 0;
+
     m_nStartTime         = GetTickCount();
 }
 
@@ -403,6 +406,12 @@ MulticoreJitProfilePlayer::~MulticoreJitProfilePlayer()
         m_pModules = NULL;
     }
 
+    if (m_pDeferredMethods != NULL)
+    {
+        delete [] m_pDeferredMethods;
+        m_pDeferredMethods = NULL;
+    }
+
     if (m_pFileBuffer != NULL)
     {
         delete [] m_pFileBuffer;
@@ -894,6 +903,11 @@ HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned mod
             MethodDesc * pMethod = MemberLoader::GetMethodDescFromMemberDefOrRefOrSpec(pModule, token, NULL, FALSE, FALSE);
             CompileMethodInfoRecord(pModule, pMethod, false);
         }
+        else if (!mod.IsModuleLoaded())
+        {
+            // The application has not loaded the module yet; retry once it does
+            DeferMethodRecord(moduleIndex, token, NULL, 0);
+        }
         else
         {
             m_stats.m_nFilteredMethods++;
@@ -948,6 +962,12 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
 
             CompileMethodInfoRecord(pModule, pMethod, true);
         }
+        else if (!mod.IsModuleLoaded())
+        {
+            // The application has not loaded the module yet; retry once it does.
+            // The signature stays valid as it points into m_pFileBuffer.
+            DeferMethodRecord(moduleIndex, 0, signature, length);
+        }
         else
         {
             m_stats.m_nFilteredMethods++;
@@ -966,6 +986,117 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
     return hr;
 }
 
+void MulticoreJitProfilePlayer::DeferMethodRecord(unsigned moduleIndex, unsigned token, const BYTE * pSignature, unsigned signatureLength)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (m_pDeferredMethods == NULL)
+    {
+        m_pDeferredMethods = new (nothrow) DeferredMethodRecord[MAX_DEFERRED_METHODS];
+    }
+
+    if ((m_pDeferredMethods == NULL) || (m_nDeferredMethodCount >= MAX_DEFERRED_METHODS))
+    {
+        // Degrade to the old behavior of dropping the method
+        m_stats.m_nFilteredMethods++;
+        return;
+    }
+
+    DeferredMethodRecord & rec = m_pDeferredMethods[m_nDeferredMethodCount++];
+
+    rec.moduleIndex     = moduleIndex;
+    rec.token           = token;
+    rec.pSignature      = pSignature;
+    rec.signatureLength = signatureLength;
+}
+
+// Replay method records that were skipped during the main profile pass because their
+// module was not loaded yet. The application loads modules on its own schedule, so poll
+// for loader progress between passes; the player's lifetime cap bounds the polling.
+HRESULT MulticoreJitProfilePlayer::PlayDeferredMethodRecords()
+{
+    STANDARD_VM_CONTRACT;
+
+    HRESULT hr = S_OK;
+
+    MulticoreJitTrace(("Replaying %d deferred method records", m_nDeferredMethodCount));
+
+    while ((m_nDeferredMethodCount > 0) && SUCCEEDED(hr))
+    {
+        if (ShouldAbort(false))
+        {
+            hr = E_ABORT;
+            break;
+        }
+
+        // Look for modules the application has loaded since the last pass
+        hr = UpdateModuleInfo();
+
+        if (FAILED(hr))
+        {
+            break;
+        }
+
+        unsigned remaining = 0;
+
+        for (unsigned i = 0; (SUCCEEDED(hr)) && (i < m_nDeferredMethodCount); i++)
+        {
+            DeferredMethodRecord & rec = m_pDeferredMethods[i];
+
+            PlayerModuleInfo & mod = m_pModules[rec.moduleIndex];
+
+            if (!mod.IsModuleLoaded())
+            {
+                // Still waiting for the application to load the module
+                m_pDeferredMethods[remaining++] = rec;
+            }
+            else if (mod.m_enableJit)
+            {
+                Module * pModule = mod.m_pModule;
+
+                if (rec.pSignature == NULL)
+                {
+                    MethodDesc * pMethod = MemberLoader::GetMethodDescFromMemberDefOrRefOrSpec(pModule, rec.token, NULL, FALSE, FALSE);
+                    CompileMethodInfoRecord(pModule, pMethod, false);
+                }
+                else
+                {
+                    SigTypeContext typeContext;   // empty type context
+                    ZapSig::Context zapSigContext(pModule, (void *)this, ZapSig::MulticoreJitTokens);
+                    MethodDesc * pMethod = NULL;
+                    EX_TRY
+                    {
+                        pMethod = ZapSig::DecodeMethod(pModule, (PCCOR_SIGNATURE)rec.pSignature, &typeContext, &zapSigContext);
+                    }
+                    EX_CATCH
+                    {
+                    }
+                    EX_END_CATCH(SwallowAllExceptions);
+
+                    CompileMethodInfoRecord(pModule, pMethod, true);
+                }
+            }
+            else
+            {
+                m_stats.m_nFilteredMethods++;
+            }
+        }
+
+        m_nDeferredMethodCount = remaining;
+
+        if (m_nDeferredMethodCount > 0)
+        {
+            ClrSleepEx(DEFERRED_RETRY_PERIOD, FALSE);
+        }
+    }
+
+    MulticoreJitTrace(("Deferred replay done, %d records left, hr=%x", m_nDeferredMethodCount, hr));
+
+    TraceSummary();
+
+    return hr;
+}
+
 void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric)
 {
     STANDARD_VM_CONTRACT;
@@ -1334,6 +1465,11 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         }
     }
 
+    if (SUCCEEDED(hr) && (m_nDeferredMethodCount > 0))
+    {
+        hr = PlayDeferredMethodRecords();
+    }
+
     start = GetTickCount() - start;
 
     {
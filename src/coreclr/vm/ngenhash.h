@@ -54,7 +54,7 @@
 //                     methods in your class used to tweak hash behavior).
 //      VALUE        : The type of your hash entries (the class defined in the previous step).
 //      SCALE_FACTOR : A multipler on bucket count every time the hash table is grown (currently once the
-//                     number of hash entries exceeds twice the number of buckets). A value of 2 would double
+//                     number of hash entries exceeds the number of buckets). A value of 2 would double
 //                     the number of buckets on each grow operation for example.
 //  3) Define a constructor that invokes the base class constructor with various setup parameters (see
 //     NgenHash constructor in this header). If your hash table is created via a static method rather than
@@ -161,7 +161,10 @@ void NgenHashTable<NGEN_HASH_ARGS>::BaseInsertEntry(NgenHashValue iHash, VALUE *
 
     // If the insertion pushed the table load over our limit then attempt to grow the bucket list. Note that
     // we ignore any failure (this is a performance operation and is not required for correctness).
-    if (m_cWarmEntries > (2 * m_cWarmBuckets))
+    // The limit keeps the average bucket chain at a single entry; the lookup paths of the type and
+    // instantiated-method tables are hot enough during generic instantiation that the extra bucket
+    // memory is a good trade for not walking chains of cold entries.
+    if (m_cWarmEntries > m_cWarmBuckets)
         GrowTable();
 }
 
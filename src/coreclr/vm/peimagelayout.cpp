@@ -107,8 +107,11 @@ PEImageLayout* PEImageLayout::Map(PEImage* pOwner)
 
     if (pAlloc->GetBase()==NULL)
     {
-        //cross-platform or a bad image
-        pAlloc = LoadConverted(pOwner);
+        // Cross-platform, a bad image, or a bundled image whose offset in the
+        // bundle file is not page-aligned, so the direct mapping was rejected.
+        // In the bundle case the converted layout must still allow execution,
+        // otherwise a misaligned entry silently loses its R2R code.
+        pAlloc = LoadConverted(pOwner, pOwner->IsInBundle());
     }
     else
     {
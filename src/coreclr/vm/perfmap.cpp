@@ -9,6 +9,7 @@
 #if defined(FEATURE_PERFMAP) && !defined(DACCESS_COMPILE)
 #include "perfmap.h"
 #include "perfinfo.h"
+#include "dbginterface.h"
 #include "pal.h"
 
 // The code addresses are actually native image offsets during crossgen. Print
@@ -24,6 +25,7 @@
 Volatile<bool> PerfMap::s_enabled = false;
 PerfMap * PerfMap::s_Current = nullptr;
 bool PerfMap::s_ShowOptimizationTiers = false;
+bool PerfMap::s_EmitDebugInfo = false;
 
 // Initialize the map for the process - called from EEStartupHelper.
 void PerfMap::Initialize()
@@ -67,6 +69,11 @@ void PerfMap::Initialize()
         }
 
         PAL_PerfJitDump_Start(jitdumpPath);
+
+        if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapJitDumpLineInfo) != 0)
+        {
+            s_EmitDebugInfo = true;
+        }
 #endif // CROSSGEN_COMPILE
     }
 }
@@ -181,7 +188,7 @@ void PerfMap::WriteLine(SString& line)
 }
 
 // Log a method to the map.
-void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, const char *optimizationTier)
+void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, const char *optimizationTier, bool fCollectDebugInfo)
 {
     CONTRACTL{
         THROWS;
@@ -216,7 +223,68 @@ void PerfMap::LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, cons
 
         // Write the line.
         WriteLine(line);
-        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetANSI(scratch), nullptr, nullptr);
+
+        PerfJitDumpDebugInfo* pDebugInfo = nullptr;
+
+#ifndef CROSSGEN_COMPILE
+        PerfJitDumpDebugInfo debugInfo;
+        NewArrayHolder<PerfJitDumpDebugEntry> entries;
+        NewArrayHolder<UINT> rguiILOffset;
+        NewArrayHolder<UINT> rguiNativeOffset;
+        SString ilFileName;
+        StackScratchBuffer fileNameScratch;
+
+        // Optionally attach the method's IL map as jitdump line records. This
+        // is the same sequence point data the MethodILToNativeMap event
+        // carries; each native offset becomes a "line" whose number is the IL
+        // offset, which perf inject compiles into DWARF so perf annotate can
+        // label instructions inside jitted code.
+        if (fCollectDebugInfo && s_EmitDebugInfo && g_pDebugInterface != nullptr)
+        {
+            USHORT cMap = 0;
+
+            // The callers ensured the debugger's lazy data is initialized.
+            // There is no 64K event size ceiling here, so no entry cap beyond
+            // what the map arrays can address.
+            if (SUCCEEDED(g_pDebugInterface->GetILToNativeMappingIntoArrays(
+                    pMethod, pCode, 0xFFFF, &cMap, &rguiILOffset, &rguiNativeOffset)) &&
+                cMap > 0)
+            {
+                entries = new PerfJitDumpDebugEntry[cMap];
+
+                ULONG count = 0;
+                for (USHORT i = 0; i < cMap; ++i)
+                {
+                    // Leave out the prolog, epilog and unmapped ranges; they
+                    // have no IL offset to report.
+                    if ((int)rguiILOffset[i] < 0)
+                    {
+                        continue;
+                    }
+
+                    entries[count].address = (ULONG64)pCode + rguiNativeOffset[i];
+                    entries[count].lineNumber = rguiILOffset[i];
+                    entries[count].discriminator = 0;
+                    count++;
+                }
+
+                if (count > 0)
+                {
+                    // IL has no source file on disk; name the pseudo file
+                    // after the method so annotated output reads as "IL
+                    // offset within this method".
+                    ilFileName.Printf("%s.il", name.GetANSI(scratch));
+
+                    debugInfo.fileName = ilFileName.GetANSI(fileNameScratch);
+                    debugInfo.entryCount = count;
+                    debugInfo.entries = entries;
+                    pDebugInfo = &debugInfo;
+                }
+            }
+        }
+#endif // CROSSGEN_COMPILE
+
+        PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetANSI(scratch), pDebugInfo, nullptr);
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -274,9 +342,26 @@ void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t cod
     {
         optimizationTier = PrepareCodeConfig::GetJitOptimizationTierStr(pConfig, pMethod);
     }
+
+    if (s_EmitDebugInfo && g_pDebugInterface != nullptr)
+    {
+        // The IL-to-native map lives in the debugger's sequence point store,
+        // whose lazy data must exist before LogMethod asks for the map. If the
+        // initialization cannot complete, give up on line info for good rather
+        // than retrying on every method.
+        EX_TRY
+        {
+            g_pDebugInterface->InitializeLazyDataIfNecessary();
+        }
+        EX_CATCH
+        {
+            s_EmitDebugInfo = false;
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
 #endif // CROSSGEN_COMPILE
 
-    s_Current->LogMethod(pMethod, pCode, codeSize, optimizationTier);
+    s_Current->LogMethod(pMethod, pCode, codeSize, optimizationTier, true /* fCollectDebugInfo */);
 }
 
 // Log a pre-compiled method to the perfmap.
@@ -24,6 +24,9 @@ private:
     // Indicates whether optimization tiers should be shown for methods in perf maps
     static bool s_ShowOptimizationTiers;
 
+    // Indicates whether IL offset line records should be written to the jitdump
+    static bool s_EmitDebugInfo;
+
     // The file stream to write the map to.
     CFileStream * m_FileStream;
 
@@ -53,8 +56,9 @@ protected:
     // Open the perf map file for write.
     void OpenFile(SString& path);
 
-    // Does the actual work to log a method to the map.
-    void LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, const char *optimizationTier);
+    // Does the actual work to log a method to the map. Line records are only
+    // collected for jitted code; pre-compiled callers log plain ranges.
+    void LogMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, const char *optimizationTier, bool fCollectDebugInfo = false);
 
     // Does the actual work to log an image
     void LogImage(PEFile * pFile);
@@ -8725,6 +8725,16 @@ HRESULT ProfToEEInterfaceImpl::DoStackSnapshot(ThreadID thread,
         // with destructors.
         AVInRuntimeImplOkayHolder AVOkay;
 
+        DWORD lightUnwindFlag = 0;
+        if ((infoFlags & COR_PRF_SNAPSHOT_REGISTER_CONTEXT) == 0)
+        {
+            // The profiler only wants function identities, so repeated walks of
+            // hot frames may use the stack walk cache's quick unwind schema.
+            // Profilers that ask for register contexts need the full unwind,
+            // which restores more state than the cache records.
+            lightUnwindFlag = LIGHTUNWIND;
+        }
+
         DWORD asyncFlags = 0;
         if (pThreadToSnapshot != pCurrentThread)
         {
@@ -8746,6 +8756,7 @@ HRESULT ProfToEEInterfaceImpl::DoStackSnapshot(ThreadID thread,
                      FUNCTIONSONLY |
                      NOTIFY_ON_U2M_TRANSITIONS |
                      asyncFlags |
+                     lightUnwindFlag |
                      THREAD_EXECUTING_MANAGED_CODE |
                      PROFILER_DO_STACK_SNAPSHOT |
                      ALLOW_INVALID_OBJECTS, // stack walk logic should not look at objects - we could be in the middle of a gc.
@@ -620,6 +620,56 @@ bool ReadyToRunInfo::IsNativeImageSharedBy(PTR_Module pModule1, PTR_Module pModu
     return pModule1->GetReadyToRunInfo()->m_pComposite == pModule2->GetReadyToRunInfo()->m_pComposite;
 }
 
+//
+// Ask the OS to start paging in a region of the mapped image ahead of first
+// access. Startup executes precompiled code roughly in method order, so
+// issuing one batched prefetch over the hot ranges lets page-in from disk
+// overlap the rest of assembly loading instead of being discovered one major
+// fault at a time. Purely advisory; failures are ignored.
+//
+static void PrefetchImageRegion(PVOID pStart, SIZE_T cbSize)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (pStart == NULL || cbSize == 0)
+        return;
+
+#ifdef TARGET_UNIX
+    PAL_PrefetchMemory(pStart, cbSize);
+#else
+    // PrefetchVirtualMemory is not available on all supported OS versions,
+    // so bind to it lazily.
+    typedef BOOL (WINAPI *PrefetchVirtualMemoryFn)(HANDLE, ULONG_PTR, PWIN32_MEMORY_RANGE_ENTRY, ULONG);
+
+    static PrefetchVirtualMemoryFn s_pfnPrefetchVirtualMemory = NULL;
+    static bool s_fPrefetchProbed = false;
+
+    if (!s_fPrefetchProbed)
+    {
+        HMODULE hMod = WszGetModuleHandle(WINDOWS_KERNEL32_DLLNAME_W);
+        if (hMod != NULL)
+        {
+            s_pfnPrefetchVirtualMemory = (PrefetchVirtualMemoryFn)GetProcAddress(hMod, "PrefetchVirtualMemory");
+        }
+        s_fPrefetchProbed = true;
+    }
+
+    if (s_pfnPrefetchVirtualMemory != NULL)
+    {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = pStart;
+        range.NumberOfBytes = cbSize;
+        (void)s_pfnPrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#endif // TARGET_UNIX
+}
+
 ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocator, PEImageLayout * pLayout, READYTORUN_HEADER * pHeader, NativeImage *pNativeImage, AllocMemTracker *pamTracker)
     : m_pModule(pModule),
     m_pHeader(pHeader),
@@ -657,6 +707,28 @@ ReadyToRunInfo::ReadyToRunInfo(Module * pModule, LoaderAllocator* pLoaderAllocat
         m_nRuntimeFunctions = 0;
     }
 
+    if (m_nRuntimeFunctions > 0 && !m_isComponentAssembly)
+    {
+        // Prefetch the precompiled code and the runtime function table that is
+        // binary searched on every first call into it. Component assemblies
+        // share the composite image's code section, which the composite
+        // ReadyToRunInfo has already prefetched.
+        TADDR base = dac_cast<TADDR>(m_pComposite->GetLayout()->GetBase());
+        DWORD beginRVA = RUNTIME_FUNCTION__BeginAddress(&m_pRuntimeFunctions[0]);
+#ifdef TARGET_X86
+        // x86 runtime function entries don't carry an end address; stopping at
+        // the last method's start just leaves its body to demand paging.
+        DWORD endRVA = RUNTIME_FUNCTION__BeginAddress(&m_pRuntimeFunctions[m_nRuntimeFunctions - 1]);
+#else
+        DWORD endRVA = RUNTIME_FUNCTION__EndAddress(&m_pRuntimeFunctions[m_nRuntimeFunctions - 1], base);
+#endif
+        if (endRVA > beginRVA)
+        {
+            PrefetchImageRegion((PVOID)(base + beginRVA), endRVA - beginRVA);
+        }
+        PrefetchImageRegion(m_pRuntimeFunctions, pRuntimeFunctionsDir->Size);
+    }
+
     IMAGE_DATA_DIRECTORY * pImportSectionsDir = m_pComposite->FindSection(ReadyToRunSectionType::ImportSections);
     if (pImportSectionsDir != NULL)
     {
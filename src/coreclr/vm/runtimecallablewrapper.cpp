@@ -670,6 +670,11 @@ RCWCache::RCWCache(AppDomain *pDomain)
     CONTRACTL_END;
 
     m_pDomain = pDomain;
+
+    // Asynchronous mode: lookups don't take m_lock, inserts and removes do.
+    // Retired bucket arrays are handed to SyncClean and freed during GC.
+    LockOwner lock = {&m_lock, IsOwnerOfCrst};
+    m_HashMap.Init(0, (CompareFnPtr)NULL, TRUE, &lock);
 }
 
 // Look up to see if we already have an valid wrapper in cache for this IUnk
@@ -841,9 +846,9 @@ void RCWCache::ReleaseWrappersWorker(LPVOID pCtxCookie)
             RCWCache::LockHolder lh(this);
 
             // Go through the hash table and add the wrappers to the cleanup lists.
-            for (SHash<RCWCacheTraits>::Iterator it = m_HashMap.Begin(); it != m_HashMap.End(); it++)
+            for (PtrHashMap::PtrIterator it = m_HashMap.begin(); !it.end(); ++it)
             {
-                RCW *pWrap = *it;
+                RCW *pWrap = (RCW *)it.GetValue();
                 _ASSERTE(pWrap != NULL);
 
                 // If a context cookie was specified, then only clean up wrappers that
@@ -933,7 +938,10 @@ void RCWCache::DetachWrappersWorker()
     CONTRACTL_END;
 
     DetachWrappersFunctor functor;
-    m_HashMap.ForEach(functor);
+    for (PtrHashMap::PtrIterator it = m_HashMap.begin(); !it.end(); ++it)
+    {
+        functor((RCW *)it.GetValue());
+    }
 }
 
 VOID RCWCleanupList::AddWrapper(RCW* pRCW)
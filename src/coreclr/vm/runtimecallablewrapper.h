@@ -67,6 +67,7 @@
 #include "comcache.h"
 #include "threads.h"
 #include "comcache.h"
+#include "hash.h"
 
 class Object;
 class ComCallWrapper;
@@ -1131,7 +1132,8 @@ public:
         }
         CONTRACTL_END;
 
-        m_HashMap.Add(pRCW->GetRawRCWUnsafe());
+        RCW *pRawRCW = pRCW->GetRawRCWUnsafe();
+        m_HashMap.InsertValue((UPTR)pRawRCW->m_pIdentity, pRawRCW);
     }
 
     void RemoveWrapper(RCWHolder* pRCW)
@@ -1164,7 +1166,7 @@ public:
         pIdentity = pRCW->m_pIdentity;
         _ASSERTE(pIdentity != NULL);
 
-        m_HashMap.Remove(pIdentity);
+        m_HashMap.DeleteValue((UPTR)pIdentity, pRCW);
     }
 
     //  Lookup to see if we already have a wrapper else insert this wrapper
@@ -1195,7 +1197,10 @@ public:
 
 #ifndef DACCESS_COMPILE
 
-    // Lookup wrapper, lookup hash table for a wrapper for a given IUnk
+    // Lookup wrapper, lookup hash table for a wrapper for a given IUnk.
+    // Callers must hold the lock: initializing the holder touches the wrapper,
+    // and without the lock the RCW can be destroyed as soon as its home STA
+    // thread dies. Use LookupWrapperUnsafe for a lock-free existence probe.
     void LookupWrapper(LPVOID pUnk, RCWHolder* pRCW)
     {
         CONTRACTL
@@ -1221,6 +1226,11 @@ public:
         pRCW->InitNoCheck(pRawRCW);
     }
 
+    // Lock-free lookup. The hash map is in async mode, so no lock is needed;
+    // cooperative mode keeps retired bucket arrays alive (they are reclaimed by
+    // SyncClean only while the EE is suspended). The returned pointer may be
+    // compared but must not be dereferenced unless the caller holds the lock or
+    // can otherwise guarantee the wrapper stays alive.
     RCW* LookupWrapperUnsafe(LPVOID pUnk)
     {
         CONTRACT (RCW*)
@@ -1229,7 +1239,6 @@ public:
             GC_NOTRIGGER;
             MODE_COOPERATIVE;
             PRECONDITION(CheckPointer(pUnk));
-            PRECONDITION(LOCKHELD());
             POSTCONDITION(CheckPointer(RETVAL, NULL_OK));
         }
         CONTRACT_END;
@@ -1237,7 +1246,11 @@ public:
         // We don't want the GC messing with the hash table underneath us.
         GCX_FORBID();
 
-        RETURN m_HashMap.Lookup(pUnk);
+        RCW* pRawRCW = (RCW*)m_HashMap.Gethash((UPTR)pUnk);
+        if (pRawRCW == (RCW*)INVALIDENTRY)
+            RETURN NULL;
+
+        RETURN pRawRCW;
     }
 
 #endif //DACCESS_COMPILE
@@ -1258,20 +1271,11 @@ private :
     void FindWrapperInCache_NoLock(IUnknown* pIdentity, RCWHolder* pRCW);
 
 private:
-    class RCWCacheTraits : public DefaultSHashTraits<RCW *>
-    {
-    public:
-        typedef LPVOID key_t;
-        static RCW *Null()                         { LIMITED_METHOD_CONTRACT; return NULL; }
-        static bool IsNull(RCW *e)                 { LIMITED_METHOD_CONTRACT; return (e == NULL); }
-        static const LPVOID GetKey(RCW *e)         { LIMITED_METHOD_CONTRACT; return e->m_pIdentity; }
-        static count_t Hash(LPVOID key_t)          { LIMITED_METHOD_CONTRACT; return (count_t)(size_t) key_t; }
-        static BOOL Equals(LPVOID lhs, LPVOID rhs) { LIMITED_METHOD_CONTRACT; return (lhs == rhs); }
-        static RCW *Deleted()                      { LIMITED_METHOD_CONTRACT; return (RCW *)-1; }
-        static bool IsDeleted(RCW *e)              { LIMITED_METHOD_CONTRACT; return e == (RCW *)-1; }
-    };
-
-    SHash<RCWCacheTraits> m_HashMap;
+    // IUnknown identity -> RCW map, running in asynchronous mode: lookups are
+    // lock-free (readers must be in cooperative mode, retired bucket arrays are
+    // freed by SyncClean during GC), while insert and remove take m_lock. The
+    // identity pointer is the key, so no value-compare function is needed.
+    PtrHashMap      m_HashMap;
 
     // spin lock for fast synchronization
     Crst            m_lock;
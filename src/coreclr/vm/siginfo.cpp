@@ -3623,6 +3623,27 @@ MetaSig::CompareElementType(
         return FALSE;
     }
 
+    // Fast path: identical bytes in the same scope under the same substitution (or none)
+    // always denote the same type, so compare the two elements wholesale before walking
+    // their structure. This can only conclude equality - on any mismatch we fall through
+    // to the full structural comparison below.
+    if ((pModule1 == pModule2) && (pSubst1 == pSubst2))
+    {
+        SigPointer ptr1(pSig1, (DWORD)(pEndSig1 - pSig1));
+        SigPointer ptr2(pSig2, (DWORD)(pEndSig2 - pSig2));
+        if (SUCCEEDED(ptr1.SkipExactlyOne()) && SUCCEEDED(ptr2.SkipExactlyOne()))
+        {
+            size_t cbElem1 = ptr1.GetPtr() - pSig1;
+            size_t cbElem2 = ptr2.GetPtr() - pSig2;
+            if ((cbElem1 == cbElem2) && (memcmp(pSig1, pSig2, cbElem1) == 0))
+            {
+                pSig1 = ptr1.GetPtr();
+                pSig2 = ptr2.GetPtr();
+                return TRUE;
+            }
+        }
+    }
+
     if ((*pSig2 == ELEMENT_TYPE_VAR) && (pSubst2 != NULL) && !pSubst2->GetInst().IsNull())
     {
         SigPointer inst = pSubst2->GetInst();
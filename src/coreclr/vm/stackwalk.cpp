@@ -3204,8 +3204,17 @@ void StackFrameIterator::PostProcessingForNoFrameTransition()
 
 
 #if defined(TARGET_AMD64) && !defined(DACCESS_COMPILE)
-static CrstStatic g_StackwalkCacheLock;                // Global StackwalkCache lock; only used on AMD64
-EXTERN_C void moveOWord(LPVOID src, LPVOID target);
+// On AMD64 a cache entry is 16 bytes - an 8-byte IP tag plus an 8-byte unwind
+// payload - and there is no atomic 16-byte move.  Instead, writers serialize on
+// a try-lock (losing an insert race is benign for a cache) and order their
+// stores so a stale tag is never paired with a fresh payload: invalidate the
+// tag, store the payload, then publish the new tag.  Readers run lock-free and
+// reject torn entries by re-checking the tag around the payload read; since the
+// JIT guarantees identical unwind data for a given IP, a stable matching tag
+// means the payload is usable.  Not blocking on lookups also keeps this path
+// safe for stack walks taken while the runtime is suspended, where sleeping on
+// a lock held by a suspended thread would deadlock.
+static LONG g_StackwalkCacheWriterLock = 0;
 #endif // TARGET_AMD64
 
 /*
@@ -3227,10 +3236,6 @@ inline static void atomicMoveCacheEntry(UINT64* src, UINT64* target)
         mov eax, target
         fistp qword ptr [eax]
     }
-#elif defined(TARGET_AMD64) && !defined(DACCESS_COMPILE)
-    // On AMD64 there's no way to move 16 bytes atomically, so we need to take a lock before calling moveOWord().
-    CrstHolder ch(&g_StackwalkCacheLock);
-    moveOWord(src, target);
 #endif
 }
 
@@ -3291,9 +3296,6 @@ StackwalkCache::StackwalkCache()
 // static
 void StackwalkCache::Init()
 {
-#if defined(TARGET_AMD64) && !defined(DACCESS_COMPILE)
-    g_StackwalkCacheLock.Init(CrstSecurityStackwalkCache, CRST_UNSAFE_ANYMODE);
-#endif // TARGET_AMD64
 }
 
 /*
@@ -3323,6 +3325,26 @@ BOOL StackwalkCache::Lookup(UINT_PTR IP)
 
     unsigned hkey = GetKey(IP);
     _ASSERTE(IS_ALIGNED((void*)&g_StackwalkCache[hkey], STACKWALK_CACHE_ENTRY_ALIGN_BOUNDARY));
+
+#if defined(TARGET_AMD64) && !defined(DACCESS_COMPILE)
+    // Lock-free read: the tag is checked on both sides of the payload read to
+    // reject entries torn by a concurrent insert (see g_StackwalkCacheWriterLock).
+    UINT64* pGlobalEntry = (UINT64*)&g_StackwalkCache[hkey];
+    UINT64 tagBefore = VolatileLoad(&pGlobalEntry[0]);
+    UINT64 payload   = VolatileLoad(&pGlobalEntry[1]);
+    UINT64 tagAfter  = VolatileLoad(&pGlobalEntry[0]);
+
+    if ((tagBefore != (UINT64)IP) || (tagBefore != tagAfter))
+    {
+        ClearEntry();
+        return FALSE;
+    }
+
+    // m_CacheEntry is private to this stackwalk/thread
+    ((UINT64*)&m_CacheEntry)[0] = tagBefore;
+    ((UINT64*)&m_CacheEntry)[1] = payload;
+    return TRUE;
+#else
     // Don't care about m_CacheEntry access atomicity, since it's private to this
     // stackwalk/thread
     atomicMoveCacheEntry((UINT64*)&g_StackwalkCache[hkey], (UINT64*)&m_CacheEntry);
@@ -3335,6 +3357,7 @@ BOOL StackwalkCache::Lookup(UINT_PTR IP)
 #endif
 
     return (IP == m_CacheEntry.IP);
+#endif // TARGET_AMD64 && !DACCESS_COMPILE
 #else // TARGET_X86
     return FALSE;
 #endif // TARGET_X86
@@ -3355,7 +3378,22 @@ void StackwalkCache::Insert(StackwalkCacheEntry *pCacheEntry)
 
     unsigned hkey = GetKey(pCacheEntry->IP);
     _ASSERTE(IS_ALIGNED((void*)&g_StackwalkCache[hkey], STACKWALK_CACHE_ENTRY_ALIGN_BOUNDARY));
+
+#if defined(TARGET_AMD64) && !defined(DACCESS_COMPILE)
+    // Serialize writers with a try-lock; a lost race just skips a cache insert.
+    // Blocking is not an option here: this can run with the runtime suspended
+    // (e.g. sample-profiler stack walks) when the lock owner may never resume.
+    if (FastInterlockExchange(&g_StackwalkCacheWriterLock, 1) == 0)
+    {
+        UINT64* pGlobalEntry = (UINT64*)&g_StackwalkCache[hkey];
+        VolatileStore(&pGlobalEntry[0], (UINT64)0);                     // invalidate the tag
+        VolatileStore(&pGlobalEntry[1], ((UINT64*)pCacheEntry)[1]);     // store the payload
+        VolatileStore(&pGlobalEntry[0], ((UINT64*)pCacheEntry)[0]);     // publish the new tag
+        VolatileStore(&g_StackwalkCacheWriterLock, (LONG)0);
+    }
+#else
     atomicMoveCacheEntry((UINT64*)pCacheEntry, (UINT64*)&g_StackwalkCache[hkey]);
+#endif // TARGET_AMD64 && !DACCESS_COMPILE
 }
 
 // static
@@ -3374,6 +3412,15 @@ void StackwalkCache::Invalidate(LoaderAllocator * pLoaderAllocator)
     we just invalidate everything
     */
 
+#if !defined(DACCESS_COMPILE)
+    // Clear the IP tags first so a lock-free reader never pairs a stale tag
+    // with a zeroed payload.
+    for (unsigned i = 0; i < NUM_OF_CACHE_ENTRIES; i++)
+    {
+        VolatileStore((UINT_PTR*)&g_StackwalkCache[i].IP, (UINT_PTR)0);
+    }
+#endif // !DACCESS_COMPILE
+
     ZeroMemory(PVOID(&g_StackwalkCache), sizeof(g_StackwalkCache));
 }
 
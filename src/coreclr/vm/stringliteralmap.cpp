@@ -158,13 +158,20 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     HashDatum Data;
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+
+    // Lock-free fast path: if the literal is already in this map then the hash table
+    // holds a reference on the entry, so the object can be handed out without taking
+    // the global lock (see the thread safety comment at the top of this file).
+    if (m_StringToEntryHashTable->GetValue(pStringData, &Data, dwHash))
+    {
+        STRINGREF *pStrObj = ((StringLiteralEntry*)Data)->GetStringObject();
+        _ASSERTE(!bAddIfNotFound || pStrObj);
+        return pStrObj;
+    }
+
     // Retrieve the string literal from the global string literal map.
     CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
-    // TODO: We can be more efficient by checking our local hash table now to see if
-    // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
-    // (Rather than waiting until after we look the string up in the global map)
-
     StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound));
 
     _ASSERTE(pEntry || !bAddIfNotFound);
@@ -172,30 +179,21 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     // If pEntry is non-null then the entry exists in the Global map. (either we retrieved it or added it just now)
     if (pEntry)
     {
-        // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-        // hashentry in the appdomain specific map.
-        // TODO: except that by not inserting into our local table we always take the global map lock
-        // and come into this path, when we could succeed at a lock free lookup above.
+        // Insert the entry into the local map even when the appdomain won't ever unload:
+        // the local entry is what lets subsequent lookups of this literal succeed on the
+        // lock-free fast path above instead of taking the global map lock every time.
 
-        if (!bAppDomainWontUnload)
+        // Make sure some other thread has not already added it.
+        if (!m_StringToEntryHashTable->GetValue(pStringData, &Data))
         {
-            // Make sure some other thread has not already added it.
-            if (!m_StringToEntryHashTable->GetValue(pStringData, &Data))
-            {
-                // Insert the handle to the string into the hash table.
-                m_StringToEntryHashTable->InsertValue(pStringData, (LPVOID)pEntry, FALSE);
-            }
-            else
-            {
-                pEntry.Release(); //while we're still under lock
-            }
+            // Insert the handle to the string into the hash table.
+            m_StringToEntryHashTable->InsertValue(pStringData, (LPVOID)pEntry, FALSE);
         }
-#ifdef _DEBUG
         else
         {
-            LOG((LF_APPDOMAIN, LL_INFO10000, "Avoided adding String literal to appdomain map: size: %d bytes\n", pStringData->GetCharCount()));
+            pEntry.Release(); //while we're still under lock
         }
-#endif
+
         pEntry.SuppressRelease();
         STRINGREF *pStrObj = NULL;
         // Retrieve the string objectref from the string literal entry.
@@ -249,28 +247,25 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
         // If pEntry is non-null then the entry exists in the Global map. (either we retrieved it or added it just now)
         if (pEntry)
         {
-            // If the entry exists in the Global map and the appdomain wont ever unload then we really don't need to add a
-            // hashentry in the appdomain specific map.
-            // TODO: except that by not inserting into our local table we always take the global map lock
-            // and come into this path, when we could succeed at a lock free lookup above.
+            // Insert the entry into the local map even when the appdomain won't ever
+            // unload, so that subsequent lookups succeed on the lock-free fast path
+            // above instead of taking the global map lock every time.
+
+            // Since GlobalStringLiteralMap::GetInternedString() could have caused a GC,
+            // we need to recreate the string data.
+            StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
 
-            if (!bAppDomainWontUnload)
+            // Make sure some other thread has not already added it.
+            if (!m_StringToEntryHashTable->GetValue(&StringData, &Data))
+            {
+                // Insert the handle to the string into the hash table.
+                m_StringToEntryHashTable->InsertValue(&StringData, (LPVOID)pEntry, FALSE);
+            }
+            else
             {
-                // Since GlobalStringLiteralMap::GetInternedString() could have caused a GC,
-                // we need to recreate the string data.
-                StringData = EEStringData((*pString)->GetStringLength(), (*pString)->GetBuffer());
-
-                // Make sure some other thread has not already added it.
-                if (!m_StringToEntryHashTable->GetValue(&StringData, &Data))
-                {
-                    // Insert the handle to the string into the hash table.
-                    m_StringToEntryHashTable->InsertValue(&StringData, (LPVOID)pEntry, FALSE);
-                }
-                else
-                {
-                    pEntry.Release(); // while we're under lock
-                }
+                pEntry.Release(); // while we're under lock
             }
+
             pEntry.SuppressRelease();
             // Retrieve the string objectref from the string literal entry.
             STRINGREF *pStrObj = NULL;
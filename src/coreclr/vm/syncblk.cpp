@@ -315,6 +315,31 @@ inline void ThreadQueue::EnqueueThread(WaitEventLink *pWaitEventLink, SyncBlock
 // Wade through the SyncBlock's list of waiting threads and remove the
 // specified thread.
 /* static */
+static BOOL RemoveThreadFromList (SLink *pListHead, Thread *pThread, SyncBlock *psb)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    SLink       *pPrior = pListHead;
+    SLink       *pLink;
+    WaitEventLink *pWaitEventLink;
+
+    while ((pLink = pPrior->m_pNext) != NULL)
+    {
+        pWaitEventLink = ThreadQueue::WaitEventLinkForLink(pLink);
+        if (pWaitEventLink->m_Thread == pThread)
+        {
+            pPrior->m_pNext = pLink->m_pNext;
+#ifdef _DEBUG
+            pLink->m_pNext = (SLink *)POISONC;
+#endif
+            _ASSERTE(pWaitEventLink->m_WaitSB == psb);
+            return TRUE;
+        }
+        pPrior = pLink;
+    }
+    return FALSE;
+}
+
 BOOL ThreadQueue::RemoveThread (Thread *pThread, SyncBlock *psb)
 {
     CONTRACTL
@@ -325,32 +350,94 @@ BOOL ThreadQueue::RemoveThread (Thread *pThread, SyncBlock *psb)
     }
     CONTRACTL_END;
 
-    BOOL res = FALSE;
+    // Be careful, the debugger inspects the queue from out of process and just looks at the memory...
+    // it must be valid even if the lock is held. Be careful if you change the way the queue is updated.
+    SyncBlockCache::LockHolder lh(SyncBlockCache::GetSyncBlockCache());
+
+    // The thread may be on the waiting queue or, if it has been released by a
+    // PulseAll whose wakeup was deferred, on the pulsed list.  Either way it must
+    // be unlinked here, before its stack-allocated WaitEventLink goes away.
+    BOOL res = RemoveThreadFromList(&psb->m_Link, pThread, psb);
+    if (!res)
+    {
+        res = RemoveThreadFromList(&psb->m_PulsedLink, pThread, psb);
+    }
+    return res;
+}
+
+// Unlink the entire Q in one pass for PulseAll.  The head is returned so the
+// caller can wake it; the rest of the cohort is parked on the SyncBlock's
+// pulsed list, preserving FIFO order, to be woken one at a time as each
+// released waiter reacquires the monitor.
+/* static */
+WaitEventLink *ThreadQueue::DequeueThreadsForPulseAll (SyncBlock *psb)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
 
     // Be careful, the debugger inspects the queue from out of process and just looks at the memory...
     // it must be valid even if the lock is held. Be careful if you change the way the queue is updated.
     SyncBlockCache::LockHolder lh(SyncBlockCache::GetSyncBlockCache());
 
-    SLink       *pPrior = &psb->m_Link;
-    SLink       *pLink;
-    WaitEventLink *pWaitEventLink;
+    SLink       *pLink = psb->m_Link.m_pNext;
 
-    while ((pLink = pPrior->m_pNext) != NULL)
+    if (pLink == NULL)
+        return NULL;
+
+    // Append everything behind the head to the pulsed list before detaching the
+    // queue, so an out-of-process walk never finds the cohort unreachable.
+    SLink       *pPrior = &psb->m_PulsedLink;
+    while (pPrior->m_pNext)
     {
-        pWaitEventLink = WaitEventLinkForLink(pLink);
-        if (pWaitEventLink->m_Thread == pThread)
-        {
-            pPrior->m_pNext = pLink->m_pNext;
+        pPrior = pPrior->m_pNext;
+    }
+    pPrior->m_pNext = pLink->m_pNext;
+
+    psb->m_Link.m_pNext = NULL;
 #ifdef _DEBUG
-            pLink->m_pNext = (SLink *)POISONC;
+    pLink->m_pNext = (SLink *)POISONC;
 #endif
-            _ASSERTE(pWaitEventLink->m_WaitSB == psb);
-            res = TRUE;
-            break;
-        }
-        pPrior = pLink;
+    WaitEventLink *ret = WaitEventLinkForLink(pLink);
+    _ASSERTE(ret->m_WaitSB == psb);
+    return ret;
+}
+
+// Unlink the head of the pulsed (deferred wakeup) list.
+/* static */
+WaitEventLink *ThreadQueue::DequeuePulsedThread (SyncBlock *psb)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
     }
-    return res;
+    CONTRACTL_END;
+
+    // Be careful, the debugger inspects the queue from out of process and just looks at the memory...
+    // it must be valid even if the lock is held. Be careful if you change the way the queue is updated.
+    SyncBlockCache::LockHolder lh(SyncBlockCache::GetSyncBlockCache());
+
+    WaitEventLink      *ret = NULL;
+    SLink       *pLink = psb->m_PulsedLink.m_pNext;
+
+    if (pLink)
+    {
+        psb->m_PulsedLink.m_pNext = pLink->m_pNext;
+#ifdef _DEBUG
+        pLink->m_pNext = (SLink *)POISONC;
+#endif
+        ret = WaitEventLinkForLink(pLink);
+        _ASSERTE(ret->m_WaitSB == psb);
+    }
+    return ret;
 }
 
 #endif //!DACCESS_COMPILE
@@ -380,6 +467,18 @@ void ThreadQueue::EnumerateThreads(SyncBlock *psb, FP_TQ_THREAD_ENUMERATION_CALL
         pCallbackFunction(pWaitEventLink->m_Thread, pUserData);
         pLink = pLink->m_pNext;
     }
+
+    // Threads released by a PulseAll but not yet woken are still blocked on the
+    // monitor's event as far as the debugger is concerned, so report them too.
+    pLink = psb->m_PulsedLink.m_pNext;
+
+    while (pLink != NULL)
+    {
+        pWaitEventLink = WaitEventLinkForLink(pLink);
+
+        pCallbackFunction(pWaitEventLink->m_Thread, pUserData);
+        pLink = pLink->m_pNext;
+    }
 }
 #endif //DACCESS_COMPILE
 
@@ -712,6 +811,13 @@ void    SyncBlockCache::InsertCleanupSyncBlock(SyncBlock* psb)
             continue;
     }
 
+    // ditto for any threads parked for deferred PulseAll wakeup
+    if (psb->m_PulsedLink.m_pNext != NULL)
+    {
+        while (ThreadQueue::DequeuePulsedThread(psb) != NULL)
+            continue;
+    }
+
 #ifdef FEATURE_COMINTEROP
     if (psb->m_pInteropInfo)
     {
@@ -2899,9 +3005,31 @@ void SyncBlock::PulseAll()
     }
     CONTRACTL_END;
 
+    // Wake only the head of the queue; the rest of the cohort is parked on the
+    // pulsed list and woken one at a time, each by its predecessor as that
+    // predecessor reacquires the monitor (see PendingSync::Restore).  Setting
+    // every event here just makes all but one waiter block on the monitor again,
+    // and with hundreds of waiters that context-switch storm is expensive.
+    WaitEventLink  *pWaitEventLink;
+
+    if ((pWaitEventLink = ThreadQueue::DequeueThreadsForPulseAll(this)) != NULL)
+        pWaitEventLink->m_EventWait->Set();
+}
+
+void SyncBlock::WakeNextPulsedWaiter()
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
     WaitEventLink  *pWaitEventLink;
 
-    while ((pWaitEventLink = ThreadQueue::DequeueThread(this)) != NULL)
+    if ((pWaitEventLink = ThreadQueue::DequeuePulsedThread(this)) != NULL)
         pWaitEventLink->m_EventWait->Set();
 }
 
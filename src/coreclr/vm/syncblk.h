@@ -150,6 +150,11 @@ inline void InitializeSpinConstants()
 #endif
 }
 
+// Converts a QueryPerformanceCounter interval into nanoseconds, as reported in
+// the ContentionStop event. Shared with the native lock contention reporting in
+// crst.cpp.
+double ComputeElapsedTimeInNanosecond(LARGE_INTEGER startTicks, LARGE_INTEGER endTicks);
+
 // this is a 'GC-aware' Lock.  It is careful to enable preemptive GC before it
 // attempts any operation that can block.  Once the operation is finished, it
 // restores the original state of GC.
@@ -967,6 +972,13 @@ class SyncBlock
     // space for the minimum, which is the pointer within an SLink.
     SLink       m_Link;
 
+    // Threads released by a PulseAll whose wakeup has been deferred are parked
+    // here.  PulseAll wakes only the head of the waiting list; each released
+    // waiter then wakes the next one off this list once it has reacquired the
+    // monitor, so the cohort doesn't stampede the scheduler just to have all
+    // but one thread block on the monitor again.
+    SLink       m_PulsedLink;
+
     // This is the hash code for the object. It can either have been transfered
     // from the header dword, in which case it will be limited to 26 bits, or
     // have been generated right into this member variable here, when it will
@@ -1188,6 +1200,10 @@ class SyncBlock
     void Pulse();
     void PulseAll();
 
+    // Wakes the next thread (if any) whose wakeup was deferred by a PulseAll.
+    // Called by each released waiter once it has reacquired the monitor.
+    void WakeNextPulsedWaiter();
+
     enum
     {
         // This bit indicates that the syncblock is valuable and can neither be discarded
@@ -1673,6 +1689,14 @@ struct ThreadQueue
     // specified thread.
     static BOOL          RemoveThread (Thread *pThread, SyncBlock *psb);
 
+    // Unlink the entire Q in one pass for PulseAll.  The head is returned so
+    // the caller can wake it; the rest of the cohort is parked on the
+    // SyncBlock's pulsed list for deferred wakeup.
+    static WaitEventLink *DequeueThreadsForPulseAll(SyncBlock *psb);
+
+    // Unlink the head of the pulsed (deferred wakeup) list.
+    static WaitEventLink *DequeuePulsedThread(SyncBlock *psb);
+
 #ifdef DACCESS_COMPILE
     // Enumerates the threads in the queue from front to back by calling
     // pCallbackFunction on each one
@@ -389,15 +389,14 @@ void UnManagedPerAppDomainTPCount::QueueUnmanagedWorkRequest(LPTHREAD_START_ROUT
         !ThreadpoolMgr::AreEtwQueueEventsSpeciallyHandled(function))
         FireEtwThreadPoolEnqueue(pWorkRequest, GetClrInstanceId());
 
-    m_lock.Init(LOCK_TYPE_DEFAULT);
-
-    {
-        SpinLock::Holder slh(&m_lock);
-
-        ThreadpoolMgr::EnqueueWorkRequest(pWorkRequest);
-        pWorkRequest.SuppressRelease();
-        m_NumRequests++;
-    }
+    //Producers don't take the queue lock: the request is pushed onto a lock-free
+    //staging stack and the next dispatcher that does hold the lock splices the
+    //staged requests onto the FIFO queue in one batch. Timer callbacks and wait
+    //completions all funnel through here, so contending with dispatchers on the
+    //queue lock used to be measurably hot on large machines.
+    FastInterlockIncrement((LONG *)&m_NumRequests);
+    pWorkRequest.SuppressRelease();
+    ThreadpoolMgr::StageWorkRequest(pWorkRequest);
 
     SetAppDomainRequestsActive();
 #endif //DACCESS_COMPILE
@@ -421,9 +420,9 @@ PVOID UnManagedPerAppDomainTPCount::DeQueueUnManagedWorkRequest(bool* lastOne)
 
     if (pWorkRequest)
     {
-        m_NumRequests--;
-
-        if(m_NumRequests > 0)
+        //m_NumRequests is updated with interlocked operations since producers
+        //increment it without holding the queue lock.
+        if (FastInterlockDecrement((LONG *)&m_NumRequests) > 0)
             *lastOne = false;
     }
 
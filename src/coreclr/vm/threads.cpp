@@ -362,7 +362,7 @@ bool Thread::DetectHandleILStubsForDebugger()
 }
 
 #ifndef _MSC_VER
-__thread ThreadLocalInfo gCurrentThreadInfo;
+__thread __attribute__((tls_model("initial-exec"))) ThreadLocalInfo gCurrentThreadInfo;
 #endif
 
 #ifndef DACCESS_COMPILE
@@ -1596,6 +1596,7 @@ Thread::Thread()
 #ifdef FEATURE_EH_FUNCLETS
     m_dwIndexClauseForCatch = 0;
     m_sfEstablisherOfActualHandlerFrame.Clear();
+    m_pCachedTrackerMemory = NULL;
 #endif // FEATURE_EH_FUNCLETS
 
     m_workerThreadPoolCompletionCount = 0;
@@ -2647,6 +2648,11 @@ Thread::~Thread()
         m_WaitEventLink.m_Next = NULL;
     }
 
+#ifdef FEATURE_EH_FUNCLETS
+    // Return any exception tracker memory cached on this thread to the pool.
+    g_theTrackerAllocator.ReleaseCachedTrackerMemory(this);
+#endif // FEATURE_EH_FUNCLETS
+
     if (m_StateNC & TSNC_ExistInThreadStore) {
         BOOL ret;
         ret = ThreadStore::RemoveThread(this);
@@ -4146,6 +4152,12 @@ void PendingSync::Restore(BOOL bRemoveFromSB)
 
     pCurThread->ResetThreadStateNC(Thread::TSNC_InRestoringSyncBlock);
 
+    // If a PulseAll deferred the wakeup of the rest of its cohort, hand the baton
+    // to the next waiter now that this thread holds (or has given up trying to
+    // hold) the monitor.  Every thread that leaves a wait comes through here, so
+    // the chain of wakeups cannot stall.
+    psb->WakeNextPulsedWaiter();
+
     if ((state & WAIT_INTERRUPT_THREADABORT) != 0)
     {
         pCurThread->HandleThreadAbort();
@@ -1042,6 +1042,7 @@ class Thread
     friend class CheckAsmOffsets;
 
     friend class ExceptionTracker;
+    friend class TrackerAllocator;
     friend class ThreadExceptionState;
 
     friend class StackFrameIterator;
@@ -4401,6 +4402,11 @@ private:
 #ifdef FEATURE_EH_FUNCLETS
     DWORD       m_dwIndexClauseForCatch;
     StackFrame  m_sfEstablisherOfActualHandlerFrame;
+
+    // One-entry cache holding the most recently freed ExceptionTracker memory
+    // for this thread.  Exception dispatch reuses it without taking the tracker
+    // allocator's global lock or scanning its pages; see TrackerAllocator.
+    ExceptionTracker* m_pCachedTrackerMemory;
 #endif // FEATURE_EH_FUNCLETS
 
 public:
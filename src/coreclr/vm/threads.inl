@@ -29,7 +29,12 @@ EXTERN_C UINT32 _tls_index;
 #ifdef _MSC_VER
 __declspec(selectany) __declspec(thread) ThreadLocalInfo gCurrentThreadInfo;
 #else
-EXTERN_C __thread ThreadLocalInfo gCurrentThreadInfo;
+// The initial-exec model pins the variable at a fixed offset from the thread
+// pointer, letting assembly stubs (see INLINE_GETTHREAD in
+// unixasmmacrosarm64.inc) load the current Thread* without a helper call. The
+// static TLS reservation is a few pointers, well within the surplus loaders
+// keep for dlopen'ed libraries.
+EXTERN_C __thread __attribute__((tls_model("initial-exec"))) ThreadLocalInfo gCurrentThreadInfo;
 #endif
 
 inline Thread* GetThreadNULLOk()
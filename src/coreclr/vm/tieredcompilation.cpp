@@ -277,7 +277,21 @@ void TieredCompilationManager::AsyncPromoteToTier1(
     {
         LockHolder tieredCompilationLockHolder;
 
-        m_methodsToOptimize.InsertTail(pMethodListItem);
+        // A method lands here at the moment it crosses its call count threshold, so
+        // queue recency approximates current call velocity: the newest entry has
+        // demonstrated its calls most recently, while entries deep in the queue may
+        // have been lukewarm startup work that has since gone idle. Servicing the
+        // queue newest-first keeps a freshly hot method from waiting behind a large
+        // warmup backlog. The queue is always drained fully, so older entries are
+        // delayed but never starved.
+        if (g_pConfig->TieredCompilation_PrioritizeRecentlyPromotedMethods())
+        {
+            m_methodsToOptimize.InsertHead(pMethodListItem);
+        }
+        else
+        {
+            m_methodsToOptimize.InsertTail(pMethodListItem);
+        }
         ++m_countOfMethodsToOptimize;
 
         LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "TieredCompilationManager::AsyncPromoteToTier1 Method=0x%pM (%s::%s), code version id=0x%x queued\n",
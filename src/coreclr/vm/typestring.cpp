@@ -702,6 +702,48 @@ void TypeString::AppendType(SString& ss, TypeHandle ty, DWORD format)
     RETURN;
 }
 
+#ifndef DACCESS_COMPILE
+
+// Exception, event and profiler paths tend to format the same handful of types over
+// and over, and rebuilding the name of a deeply instantiated generic type is not cheap.
+// This is a small hash-consed cache of fully formatted names keyed by (TypeHandle, format).
+// A slot is claimed at most once, so the memory it can pin is bounded and a published
+// entry is immutable, which lets readers consume it without any locking. Entries are
+// never replaced or freed; once the cache fills up, later types simply format directly.
+struct CachedTypeName
+{
+    TypeHandle th;
+    DWORD format;
+    SString name;
+};
+
+static const DWORD TYPE_NAME_CACHE_SIZE = 128; // must be a power of two
+static CachedTypeName* s_typeNameCache[TYPE_NAME_CACHE_SIZE];
+
+static DWORD TypeNameCacheIndex(TypeHandle ty, DWORD format)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    TADDR addr = ty.AsTAddr();
+    return (DWORD)((addr >> 3) ^ (addr >> 13) ^ format) & (TYPE_NAME_CACHE_SIZE - 1);
+}
+
+static BOOL IsTypeNameCacheable(TypeHandle ty)
+{
+    STATIC_CONTRACT_NOTHROW;
+    STATIC_CONTRACT_GC_NOTRIGGER;
+
+    if (ty.IsNull())
+        return FALSE;
+
+    // A collectible type can be unloaded and its handle value reused, which would leave
+    // a stale name behind for the new type. Keep collectible types out of the cache.
+    LoaderAllocator* pLoaderAllocator = ty.GetLoaderAllocator();
+    return pLoaderAllocator != NULL && !pLoaderAllocator->IsCollectible();
+}
+
+#endif // !DACCESS_COMPILE
+
 void TypeString::AppendType(SString& ss, TypeHandle ty, Instantiation typeInstantiation, DWORD format)
 {
     CONTRACT_VOID
@@ -712,6 +754,47 @@ void TypeString::AppendType(SString& ss, TypeHandle ty, Instantiation typeInstan
     }
     CONTRACT_END
 
+#ifndef DACCESS_COMPILE
+    if (typeInstantiation.IsEmpty() && IsTypeNameCacheable(ty))
+    {
+        DWORD index = TypeNameCacheIndex(ty, format);
+        CachedTypeName* pEntry = VolatileLoad(&s_typeNameCache[index]);
+        if (pEntry != NULL && pEntry->th == ty && pEntry->format == format)
+        {
+            ss.Append(pEntry->name);
+            RETURN;
+        }
+
+        // Format into a scratch string so the result can be published for reuse
+        // as well as appended to the caller's buffer.
+        StackSString scratch;
+        {
+            TypeNameBuilder tnb(&scratch);
+            if ((format & FormatAngleBrackets) != 0)
+                tnb.SetUseAngleBracketsForGenerics(TRUE);
+            AppendType(tnb, ty, typeInstantiation, format);
+        }
+        ss.Append(scratch);
+
+        if (pEntry == NULL)
+        {
+            NewHolder<CachedTypeName> pNew = new (nothrow) CachedTypeName();
+            if (pNew != NULL)
+            {
+                pNew->th = ty;
+                pNew->format = format;
+                pNew->name.Set(scratch);
+                // Normalize so concurrent readers never trigger a lazy in-place conversion.
+                pNew->name.Normalize();
+                if (FastInterlockCompareExchangePointer(&s_typeNameCache[index], pNew.GetValue(), (CachedTypeName*)NULL) == NULL)
+                    pNew.SuppressRelease();
+            }
+        }
+
+        RETURN;
+    }
+#endif // !DACCESS_COMPILE
+
     {
         TypeNameBuilder tnb(&ss);
         if ((format & FormatAngleBrackets) != 0)
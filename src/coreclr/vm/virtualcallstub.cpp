@@ -106,6 +106,13 @@ UINT32 STUB_COLLIDE_WRITE_PCT = 100;
 UINT32 STUB_COLLIDE_MONO_PCT  =   0;
 #endif // STUB_LOGGING
 
+// Percent chance that a resolve stub miss that finds an existing dispatch stub for the
+// observed type re-patches the call site back to that dispatch stub. This lets a site
+// that was briefly polymorphic (e.g. flipped types during startup) become monomorphic
+// again instead of paying the resolve stub hash lookup forever. If the site is still
+// polymorphic the dispatch stub's miss path demotes it back to the resolve stub.
+UINT32 g_respecializeMonoPct = 25;
+
 FastTable* BucketTable::dead = NULL;    //linked list of the abandoned buckets
 
 DispatchCache *g_resolveCache = NULL;    //cache of dispatch stubs for in line lookup by resolve stubs.
@@ -859,6 +866,9 @@ void VirtualCallStubManager::InitStatic()
     g_resetCacheIncr       = (INT32) CLRConfig::GetConfigValue(CLRConfig::INTERNAL_VirtualCallStubResetCacheIncr);
 #endif // STUB_LOGGING
 
+    g_respecializeMonoPct  = (UINT32) CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_VirtualCallStubRespecializeMonoPct);
+    _ASSERTE(g_respecializeMonoPct <= 100);
+
 #ifndef STUB_DISPATCH_PORTABLE
     DispatchHolder::InitializeStatic();
     ResolveHolder::InitializeStatic();
@@ -2138,6 +2148,20 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
             {
                 BackPatchSite(pCallSite, (PCODE)stub);
             }
+            else if ((stubKind == SK_RESOLVE) && isDispatchingStub(stub) && (g_respecializeMonoPct > 0))
+            {
+                // We missed in a resolve stub but a dispatch stub already exists for the
+                // type we just saw, so the site may have become monomorphic again.
+                // Occasionally re-patch the site back to the dispatch stub. If the site
+                // is in fact still polymorphic, the dispatch stub's miss path will count
+                // down the resolve stub's shared counter and demote the site again, so a
+                // wrong guess costs a bounded number of dispatch stub misses.
+                UINT32 coin = UINT32(GetRandomInt(100));
+                if (coin < g_respecializeMonoPct)
+                {
+                    BackPatchSite(pCallSite, (PCODE)stub, TRUE /* fAllowRespecialize */);
+                }
+            }
         }
     }
     EX_CATCH
@@ -2658,7 +2682,7 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
 //----------------------------------------------------------------------------
 /* consider changing the call site to point to stub, if appropriate do it
 */
-void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
+void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub, BOOL fAllowRespecialize)
 {
     CONTRACTL {
         NOTHROW;
@@ -2682,7 +2706,8 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     //  prior           new
     //  lookup          dispatching or resolving
     //  dispatching     resolving
-    if (isResolvingStub(prior))
+    //  resolving       dispatching (only when explicitly re-specializing the site)
+    if (isResolvingStub(prior) && !(fAllowRespecialize && isDispatchingStub(stub)))
         return;
 
     if(isDispatchingStub(stub))
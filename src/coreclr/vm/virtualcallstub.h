@@ -615,7 +615,7 @@ public:
     void BackPatchWorker(StubCallSite* pCallSite);
 
     //Change the callsite to point to stub
-    void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
+    void BackPatchSite(StubCallSite* pCallSite, PCODE stub, BOOL fAllowRespecialize = FALSE);
 
 public:
     /* the following two public functions are to support tracing or stepping thru
@@ -32,6 +32,7 @@ Revision History:
 #include "nativeoverlapped.h"
 #include "hillclimbing.h"
 #include "configuration.h"
+#include "cachelineaudit.h"
 
 
 #ifndef TARGET_UNIX
@@ -120,6 +121,8 @@ DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) unsigned int ThreadpoolMgr::LastDequeueTime;
 SPTR_IMPL(WorkRequest,ThreadpoolMgr,WorkRequestHead);        // Head of work request queue
 SPTR_IMPL(WorkRequest,ThreadpoolMgr,WorkRequestTail);        // Head of work request queue
 
+WorkRequest* volatile ThreadpoolMgr::WorkRequestStagingStack = NULL;  // Lock-free producer staging stack
+
 SVAL_IMPL(ThreadpoolMgr::LIST_ENTRY,ThreadpoolMgr,TimerQueue);  // queue of timers
 
 //unsigned int ThreadpoolMgr::LastCpuSamplingTime=0;      //  last time cpu utilization was sampled by gate thread
@@ -354,6 +357,16 @@ BOOL ThreadpoolMgr::Initialize()
     NumberOfProcessors = GetCurrentProcessCpuCount();
     InitPlatformVariables();
 
+    // These counters are written from different threads and are padded onto
+    // their own cache lines with DECLSPEC_ALIGN; register them so the audit
+    // catches a layout change that puts unrelated hot state next to them.
+    CACHE_LINE_AUDIT(WorkerCounter);
+    CACHE_LINE_AUDIT(LastDequeueTime);
+    CACHE_LINE_AUDIT(PriorCompletedWorkRequests);
+    CACHE_LINE_AUDIT(GateThreadStatus);
+    CACHE_LINE_AUDIT(LastTickCount);
+    CACHE_LINE_AUDIT(cpuUtilization);
+
     EX_TRY
     {
         if (!UsePortableThreadPool())
@@ -887,7 +900,7 @@ BOOL ThreadpoolMgr::QueueUserWorkItem(LPTHREAD_START_ROUTINE Function,
 {
     CONTRACTL
     {
-        THROWS;     // EnsureInitialized, EnqueueWorkRequest can throw OOM
+        THROWS;     // EnsureInitialized, MakeWorkRequest can throw OOM
         GC_TRIGGERS;
         MODE_ANY;
     }
@@ -1422,21 +1435,6 @@ bool ThreadpoolMgr::ShouldGateThreadKeepRunning()
 
 
 //************************************************************************
-void ThreadpoolMgr::EnqueueWorkRequest(WorkRequest* workRequest)
-{
-    CONTRACTL
-    {
-        NOTHROW;
-        MODE_ANY;
-        GC_NOTRIGGER;
-    }
-    CONTRACTL_END;
-
-    _ASSERTE(!UsePortableThreadPool());
-
-    AppendWorkRequest(workRequest);
-}
-
 WorkRequest* ThreadpoolMgr::DequeueWorkRequest()
 {
     WorkRequest* entry = NULL;
@@ -1451,6 +1449,8 @@ WorkRequest* ThreadpoolMgr::DequeueWorkRequest()
 
     _ASSERTE(!UsePortableThreadPool());
 
+    DrainStagedWorkRequests();
+
     entry = RemoveWorkRequest();
 
     RETURN entry;
@@ -4193,19 +4193,32 @@ void ThreadpoolMgr::PerformGateActivities(int cpuUtilization)
     if (!UsePortableThreadPool() &&
         0 == CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_DisableStarvationDetection))
     {
+        // When every worker is parked in a blocking wait, injecting a single thread per
+        // gate cycle recovers far too slowly - hill climbing won't help because no work
+        // items are completing.  Escalate the number of threads injected per starved
+        // cycle (1, 2, 4, ...) so deep blocking spirals recover in a handful of cycles,
+        // and reset the burst as soon as a cycle finds the queue making progress.
+        // Only the gate thread runs this code, so no synchronization is needed here.
+        static DWORD s_starvationBurst = 1;
+        const DWORD maxStarvationBurst = 16;
+
         if (PerAppDomainTPCountList::AreRequestsPendingInAnyAppDomains() && SufficientDelaySinceLastDequeue())
         {
             DangerousNonHostedSpinLockHolder tal(&ThreadAdjustmentLock);
 
+            DWORD injected = 0;
             ThreadCounter::Counts counts = WorkerCounter.GetCleanCounts();
             while (counts.NumActive < MaxLimitTotalWorkerThreads && //don't add a thread if we're at the max
                     counts.NumActive >= counts.MaxWorking)            //don't add a thread if we're already in the process of adding threads
             {
-                bool breakIntoDebugger = (0 != CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_DebugBreakOnWorkerStarvation));
-                if (breakIntoDebugger)
+                if (injected == 0)
                 {
-                    OutputDebugStringW(W("The CLR ThreadPool detected work queue starvation!"));
-                    DebugBreak();
+                    bool breakIntoDebugger = (0 != CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_DebugBreakOnWorkerStarvation));
+                    if (breakIntoDebugger)
+                    {
+                        OutputDebugStringW(W("The CLR ThreadPool detected work queue starvation!"));
+                        DebugBreak();
+                    }
                 }
 
                 ThreadCounter::Counts newCounts = counts;
@@ -4216,13 +4229,26 @@ void ThreadpoolMgr::PerformGateActivities(int cpuUtilization)
                 {
                     HillClimbingInstance.ForceChange(newCounts.MaxWorking, Starvation);
                     MaybeAddWorkingWorker();
-                    break;
+                    if (++injected >= s_starvationBurst)
+                    {
+                        break;
+                    }
+                    counts = WorkerCounter.GetCleanCounts();
                 }
                 else
                 {
                     counts = oldCounts;
                 }
             }
+
+            if (injected > 0)
+            {
+                s_starvationBurst = min(s_starvationBurst * 2, maxStarvationBurst);
+            }
+        }
+        else
+        {
+            s_starvationBurst = 1;
         }
     }
 }
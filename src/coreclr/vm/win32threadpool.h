@@ -780,15 +780,13 @@ public:
 
     static BOOL CreateWorkerThread();
 
-    static void EnqueueWorkRequest(WorkRequest* wr);
-
     static WorkRequest* DequeueWorkRequest();
 
     static void ExecuteWorkRequest(bool* foundWork, bool* wasNotRecalled);
 
 #ifndef DACCESS_COMPILE
 
-    inline static void AppendWorkRequest(WorkRequest* entry)
+    inline static WorkRequest* RemoveWorkRequest()
     {
         CONTRACTL
         {
@@ -800,22 +798,48 @@ public:
 
         _ASSERTE(!UsePortableThreadPool());
 
-        if (WorkRequestTail)
+        WorkRequest* entry = NULL;
+        if (WorkRequestHead)
         {
-            _ASSERTE(WorkRequestHead != NULL);
-            WorkRequestTail->next = entry;
+            entry = WorkRequestHead;
+            WorkRequestHead = entry->next;
+            if (WorkRequestHead == NULL)
+                WorkRequestTail = NULL;
         }
-        else
+        return entry;
+    }
+
+    // Pushes a work request onto the lock-free staging stack.  Producers (timer
+    // callbacks, wait completions, user work items) use this instead of taking the
+    // queue lock; the next dispatcher to hold the lock moves the staged requests
+    // onto the FIFO queue.  Note that staged requests are not yet visible on
+    // WorkRequestHead, so debugger queue walks miss them until a dispatcher runs.
+    inline static void StageWorkRequest(WorkRequest* entry)
+    {
+        CONTRACTL
         {
-            _ASSERTE(WorkRequestHead == NULL);
-            WorkRequestHead = entry;
+            NOTHROW;
+            MODE_ANY;
+            GC_NOTRIGGER;
         }
+        CONTRACTL_END;
 
-        WorkRequestTail = entry;
-        _ASSERTE(WorkRequestTail->next == NULL);
+        _ASSERTE(!UsePortableThreadPool());
+
+        WorkRequest* head = VolatileLoad(&WorkRequestStagingStack);
+        while (true)
+        {
+            entry->next = head;
+            WorkRequest* prev = FastInterlockCompareExchangePointer(&WorkRequestStagingStack, entry, head);
+            if (prev == head)
+                break;
+            head = prev;
+        }
     }
 
-    inline static WorkRequest* RemoveWorkRequest()
+    // Moves everything from the staging stack onto the work request queue, oldest
+    // request first.  Must be called with the queue lock held.
+    inline static void DrainStagedWorkRequests()
     {
         CONTRACTL
         {
@@ -827,15 +851,35 @@ public:
 
         _ASSERTE(!UsePortableThreadPool());
 
-        WorkRequest* entry = NULL;
-        if (WorkRequestHead)
+        WorkRequest* staged = FastInterlockExchangePointer(&WorkRequestStagingStack, (WorkRequest*)NULL);
+        if (staged == NULL)
+            return;
+
+        // The stack is newest-first; reverse it so the queue stays FIFO.  The first
+        // node processed (the newest request) becomes the tail of the spliced chain.
+        WorkRequest* reversed = NULL;
+        WorkRequest* stagedTail = staged;
+        while (staged)
         {
-            entry = WorkRequestHead;
-            WorkRequestHead = entry->next;
-            if (WorkRequestHead == NULL)
-                WorkRequestTail = NULL;
+            WorkRequest* next = staged->next;
+            staged->next = reversed;
+            reversed = staged;
+            staged = next;
         }
-        return entry;
+
+        if (WorkRequestTail)
+        {
+            _ASSERTE(WorkRequestHead != NULL);
+            WorkRequestTail->next = reversed;
+        }
+        else
+        {
+            _ASSERTE(WorkRequestHead == NULL);
+            WorkRequestHead = reversed;
+        }
+
+        WorkRequestTail = stagedTail;
+        _ASSERTE(WorkRequestTail->next == NULL);
     }
 
 public:
@@ -1046,6 +1090,10 @@ private:
     SPTR_DECL(WorkRequest,WorkRequestHead);             // Head of work request queue
     SPTR_DECL(WorkRequest,WorkRequestTail);             // Head of work request queue
 
+    static WorkRequest* volatile WorkRequestStagingStack; // Lock-free stack where producers stage work
+                                                          // requests without taking the queue lock; drained
+                                                          // onto the FIFO queue by dispatchers under the lock
+
     static unsigned int LastCPThreadCreation;		// last time a completion port thread was created
     static unsigned int NumberOfProcessors;             // = NumberOfWorkerThreads - no. of blocked threads
 
@@ -30,10 +30,12 @@ static const Entry s_compressionNative[] =
     DllImportEntry(CompressionNative_DeflateEnd)
     DllImportEntry(CompressionNative_DeflateReset)
     DllImportEntry(CompressionNative_DeflateInit2_)
+    DllImportEntry(CompressionNative_DeflateSetDictionary)
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateReset)
     DllImportEntry(CompressionNative_InflateInit2_)
+    DllImportEntry(CompressionNative_InflateSetDictionary)
 };
 
 EXTERN_C const void* CompressionResolveDllImport(const char* name);
@@ -18,6 +18,7 @@ c_static_assert(PAL_Z_FINISH == Z_FINISH);
 
 c_static_assert(PAL_Z_OK == Z_OK);
 c_static_assert(PAL_Z_STREAMEND == Z_STREAM_END);
+c_static_assert(PAL_Z_NEEDDICT == Z_NEED_DICT);
 c_static_assert(PAL_Z_STREAMERROR == Z_STREAM_ERROR);
 c_static_assert(PAL_Z_DATAERROR == Z_DATA_ERROR);
 c_static_assert(PAL_Z_MEMERROR == Z_MEM_ERROR);
@@ -146,6 +147,18 @@ int32_t CompressionNative_DeflateReset(PAL_ZStream* stream)
     return result;
 }
 
+int32_t CompressionNative_DeflateSetDictionary(PAL_ZStream* stream, const uint8_t* dictionary, uint32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = deflateSetDictionary(zStream, dictionary, dictionaryLength);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_DeflateEnd(PAL_ZStream* stream)
 {
     assert(stream != NULL);
@@ -194,6 +207,18 @@ int32_t CompressionNative_InflateReset(PAL_ZStream* stream)
     return result;
 }
 
+int32_t CompressionNative_InflateSetDictionary(PAL_ZStream* stream, const uint8_t* dictionary, uint32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = inflateSetDictionary(zStream, dictionary, dictionaryLength);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_InflateEnd(PAL_ZStream* stream)
 {
     assert(stream != NULL);
@@ -46,6 +46,7 @@ enum PAL_ErrorCode
 {
     PAL_Z_OK = 0,
     PAL_Z_STREAMEND = 1,
+    PAL_Z_NEEDDICT = 2,
     PAL_Z_STREAMERROR = -2,
     PAL_Z_DATAERROR = -3,
     PAL_Z_MEMERROR = -4,
@@ -96,13 +97,25 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Deflate(PAL_ZStream* stream, int32_t flush);
 
 /*
-This function is equivalent to DeflateEnd followed by DeflateInit, but does not free and reallocate 
+This function is equivalent to DeflateEnd followed by DeflateInit, but does not free and reallocate
 the internal compression state. The stream will leave the compression level and any other attributes that may have been set unchanged.
 
 Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateReset(PAL_ZStream* stream);
 
+/*
+Sets the preset compression dictionary for the PAL_ZStream. Must be called after
+DeflateInit2_ or DeflateReset and before the first call to Deflate. Priming the
+window with a dictionary of expected content improves the ratio for small
+payloads, and also lets independent blocks of one input be compressed in
+parallel by seeding each stream with the tail of the preceding block.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_DeflateSetDictionary(
+    PAL_ZStream* stream, const uint8_t* dictionary, uint32_t dictionaryLength);
+
 /*
 All dynamically allocated data structures for this stream are freed.
 
@@ -133,6 +146,16 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_InflateReset(PAL_ZStream* stream);
 
+/*
+Sets the preset decompression dictionary for the PAL_ZStream. Must be called
+after Inflate returns PAL_Z_NEEDDICT with the dictionary that was used by the
+corresponding compressor.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_InflateSetDictionary(
+    PAL_ZStream* stream, const uint8_t* dictionary, uint32_t dictionaryLength);
+
 /*
 All dynamically allocated data structures for this stream are freed.
 
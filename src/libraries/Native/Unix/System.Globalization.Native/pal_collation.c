@@ -1141,3 +1141,43 @@ int32_t GlobalizationNative_GetSortKey(
 
     return result;
 }
+
+/*
+ * Generates sort keys for a batch of strings with a single collator lookup and
+ * interop transition. The keys are written back to back into sortKeys, and the
+ * full length of each key is stored in sortKeyLengths whether or not it was
+ * written. Returns the total number of bytes required for all the keys; if the
+ * return value exceeds cbSortKeysLength the buffer contents are not usable and
+ * the call should be repeated with a buffer of the returned size.
+ */
+int32_t GlobalizationNative_GetSortKeys(
+                        SortHandle* pSortHandle,
+                        const UChar* const* lpStrs,
+                        const int32_t* cwStrLengths,
+                        uint8_t* sortKeys,
+                        int32_t cbSortKeysLength,
+                        int32_t* sortKeyLengths,
+                        int32_t stringCount,
+                        int32_t options)
+{
+    UErrorCode err = U_ZERO_ERROR;
+    const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
+
+    if (!U_SUCCESS(err))
+    {
+        return 0;
+    }
+
+    int32_t totalLength = 0;
+    for (int32_t i = 0; i < stringCount; i++)
+    {
+        int32_t availableLength = totalLength < cbSortKeysLength ? cbSortKeysLength - totalLength : 0;
+        int32_t keyLength = ucol_getSortKey(
+            pColl, lpStrs[i], cwStrLengths[i], availableLength > 0 ? sortKeys + totalLength : NULL, availableLength);
+
+        sortKeyLengths[i] = keyLength;
+        totalLength += keyLength;
+    }
+
+    return totalLength;
+}
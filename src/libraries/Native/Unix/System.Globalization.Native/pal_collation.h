@@ -61,3 +61,12 @@ PALEXPORT int32_t GlobalizationNative_GetSortKey(SortHandle* pSortHandle,
                                                  uint8_t* sortKey,
                                                  int32_t cbSortKeyLength,
                                                  int32_t options);
+
+PALEXPORT int32_t GlobalizationNative_GetSortKeys(SortHandle* pSortHandle,
+                                                  const UChar* const* lpStrs,
+                                                  const int32_t* cwStrLengths,
+                                                  uint8_t* sortKeys,
+                                                  int32_t cbSortKeysLength,
+                                                  int32_t* sortKeyLengths,
+                                                  int32_t stringCount,
+                                                  int32_t options);
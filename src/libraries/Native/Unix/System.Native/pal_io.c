@@ -1212,7 +1212,43 @@ int32_t SystemNative_CopyFile(intptr_t sourceFd, intptr_t destinationFd)
     // `size_t' a 32-bit integer while the `st_size' field of the stat structure will be off64_t.
     // So `size' will have to be `uint64_t'. In all other cases, it will be `size_t'.
     uint64_t size = (uint64_t)sourceStat.st_size;
+#if HAVE_COPY_FILE_RANGE
     if (size != 0)
+    {
+        // Prefer copy_file_range (Linux 4.5+) over sendfile: the copy likewise
+        // stays in the kernel, and the filesystem can accelerate it further,
+        // e.g. with reflinks on Btrfs/XFS or server-side copy offload on NFS.
+        uint64_t remaining = size;
+        while (remaining > 0)
+        {
+            ssize_t copiedBytes;
+            while ((copiedBytes = copy_file_range(inFd, NULL, outFd, NULL, (remaining >= SSIZE_MAX ? SSIZE_MAX : (size_t)remaining), 0)) < 0 && errno == EINTR);
+            if (copiedBytes <= 0)
+            {
+                // Old kernels, cross-device copies (pre-5.3), and filesystems
+                // that don't support the operation fail with a variety of
+                // errors (ENOSYS, EXDEV, EINVAL, ...); a 0 return indicates a
+                // concurrent truncation. In all cases fall back to sendfile,
+                // which re-copies from the current (unknown) file offsets, so
+                // only fall back if nothing has been transferred yet.
+                break;
+            }
+
+            assert((uint64_t)copiedBytes <= remaining);
+            remaining -= (uint64_t)copiedBytes;
+        }
+
+        if (remaining == 0)
+        {
+            copied = true;
+        }
+        else if (remaining != size)
+        {
+            return -1;
+        }
+    }
+#endif // HAVE_COPY_FILE_RANGE
+    if (!copied && size != 0)
     {
         // Note that per man page for large files, you have to iterate until the
         // whole file is copied (Linux has a limit of 0x7ffff000 bytes copied).
@@ -1490,6 +1490,224 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+// The batched message functions process the caller's array in fixed-size chunks
+// so that the platform mmsghdr array can live on the stack.
+#define MESSAGES_PER_BATCH 64
+
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int32_t* receivedBytes, int32_t messageCount, int32_t flags, int32_t* messagesReceived)
+{
+    if (messageHeaders == NULL || receivedBytes == NULL || messagesReceived == NULL || messageCount < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesReceived = 0;
+
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 ||
+            messageHeaders[i].IOVectorCount < 0)
+        {
+            return Error_EFAULT;
+        }
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    int32_t completed = 0;
+#if defined(__linux__)
+    while (completed < messageCount)
+    {
+        struct mmsghdr headers[MESSAGES_PER_BATCH];
+        int batch = Min(messageCount - completed, MESSAGES_PER_BATCH);
+
+        for (int i = 0; i < batch; i++)
+        {
+            ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[completed + i], fd);
+            headers[i].msg_len = 0;
+        }
+
+        // Block for the first message only; once data has started flowing, drain
+        // whatever else is already queued without waiting for the full batch.
+        int batchFlags = completed == 0 ? (socketFlags | MSG_WAITFORONE) : (socketFlags | MSG_DONTWAIT);
+
+        int res;
+        while ((res = recvmmsg(fd, headers, (unsigned int)batch, batchFlags, NULL)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            if (completed > 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                break;
+            }
+
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        for (int i = 0; i < res; i++)
+        {
+            MessageHeader* messageHeader = &messageHeaders[completed + i];
+            struct msghdr* header = &headers[i].msg_hdr;
+
+            messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+            messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+            messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+            receivedBytes[completed + i] = (int32_t)headers[i].msg_len;
+        }
+
+        completed += res;
+        if (res < batch)
+        {
+            break;
+        }
+    }
+#else
+    while (completed < messageCount)
+    {
+        MessageHeader* messageHeader = &messageHeaders[completed];
+
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, messageHeader, fd);
+
+        // As above: block for the first message only.
+        int msgFlags = completed == 0 ? socketFlags : (socketFlags | MSG_DONTWAIT);
+
+        ssize_t res;
+        while ((res = recvmsg(fd, &header, msgFlags)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            if (completed > 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                break;
+            }
+
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        messageHeader->SocketAddressLen = Min((int32_t)header.msg_namelen, messageHeader->SocketAddressLen);
+        messageHeader->ControlBufferLen = Min((int32_t)header.msg_controllen, messageHeader->ControlBufferLen);
+        messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header.msg_flags);
+        receivedBytes[completed] = (int32_t)res;
+
+        completed++;
+    }
+#endif
+
+    *messagesReceived = completed;
+    return Error_SUCCESS;
+}
+
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int32_t* sentBytes, int32_t messageCount, int32_t flags, int32_t* messagesSent)
+{
+    if (messageHeaders == NULL || sentBytes == NULL || messagesSent == NULL || messageCount < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *messagesSent = 0;
+
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 ||
+            messageHeaders[i].IOVectorCount < 0)
+        {
+            return Error_EFAULT;
+        }
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    int32_t completed = 0;
+#if defined(__linux__)
+    while (completed < messageCount)
+    {
+        struct mmsghdr headers[MESSAGES_PER_BATCH];
+        int batch = Min(messageCount - completed, MESSAGES_PER_BATCH);
+
+        for (int i = 0; i < batch; i++)
+        {
+            ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[completed + i], fd);
+            headers[i].msg_len = 0;
+        }
+
+        int res;
+        while ((res = sendmmsg(fd, headers, (unsigned int)batch, socketFlags)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            if (completed > 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                break;
+            }
+
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        for (int i = 0; i < res; i++)
+        {
+            sentBytes[completed + i] = (int32_t)headers[i].msg_len;
+        }
+
+        completed += res;
+
+        // A short count means a later message hit an error; report what was sent
+        // and let the caller retry the remainder to observe the error.
+        if (res < batch)
+        {
+            break;
+        }
+    }
+#else
+    while (completed < messageCount)
+    {
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[completed], fd);
+
+        // Block for the first message only so a full send buffer doesn't stall
+        // the rest of the batch.
+        int msgFlags = completed == 0 ? socketFlags : (socketFlags | MSG_DONTWAIT);
+
+        ssize_t res;
+#if defined(__APPLE__) && __APPLE__
+        // possible OSX kernel bug: https://github.com/dotnet/runtime/issues/27221
+        while ((res = sendmsg(fd, &header, msgFlags)) < 0 && (errno == EINTR || errno == EPROTOTYPE));
+#else
+        while ((res = sendmsg(fd, &header, msgFlags)) < 0 && errno == EINTR);
+#endif
+        if (res < 0)
+        {
+            if (completed > 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                break;
+            }
+
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        sentBytes[completed] = (int32_t)res;
+        completed++;
+    }
+#endif
+
+    *messagesSent = completed;
+    return Error_SUCCESS;
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
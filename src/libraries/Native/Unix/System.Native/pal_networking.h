@@ -360,6 +360,12 @@ PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t buffe
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+PALEXPORT int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int32_t* receivedBytes, int32_t messageCount, int32_t flags, int32_t* messagesReceived);
+
+PALEXPORT int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int32_t* sentBytes, int32_t messageCount, int32_t flags, int32_t* messagesSent);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -116,6 +116,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpCipherCtxSetPadding)
     DllImportEntry(CryptoNative_EvpCipherDestroy)
     DllImportEntry(CryptoNative_EvpCipherFinalEx)
+    DllImportEntry(CryptoNative_EvpCipherGcmTransformBatch)
     DllImportEntry(CryptoNative_EvpCipherGetCcmTag)
     DllImportEntry(CryptoNative_EvpCipherGetGcmTag)
     DllImportEntry(CryptoNative_EvpCipherGetAeadTag)
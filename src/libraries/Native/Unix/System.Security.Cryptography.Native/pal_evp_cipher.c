@@ -222,6 +222,96 @@ int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int3
 #endif
 }
 
+static int32_t GcmTransformOne(EVP_CIPHER_CTX* ctx,
+                               int32_t enc,
+                               uint8_t* nonce,
+                               uint8_t* aad,
+                               int32_t aadLength,
+                               uint8_t* input,
+                               int32_t inputLength,
+                               uint8_t* output,
+                               uint8_t* tag,
+                               int32_t tagLength)
+{
+    int outLength;
+
+    // Re-priming with a fresh nonce keeps the key schedule; this is the cheap
+    // per-operation reset that avoids a full context setup.
+    if (!EVP_CipherInit_ex(ctx, NULL, NULL, NULL, nonce, KEEP_CURRENT_DIRECTION))
+    {
+        return 0;
+    }
+
+    if (!enc && !EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, tagLength, tag))
+    {
+        return 0;
+    }
+
+    if (aadLength > 0 && !EVP_CipherUpdate(ctx, NULL, &outLength, aad, aadLength))
+    {
+        return 0;
+    }
+
+    if (!EVP_CipherUpdate(ctx, output, &outLength, input, inputLength))
+    {
+        return 0;
+    }
+
+    // For GCM the final call produces no output; for decryption it verifies the tag.
+    if (!EVP_CipherFinal_ex(ctx, output + outLength, &outLength))
+    {
+        return 0;
+    }
+
+    if (enc && !EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, tagLength, tag))
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
+int32_t CryptoNative_EvpCipherGcmTransformBatch(EVP_CIPHER_CTX* ctx,
+                                                int32_t enc,
+                                                uint8_t* const* nonces,
+                                                int32_t nonceLength,
+                                                uint8_t* const* aads,
+                                                const int32_t* aadLengths,
+                                                uint8_t* const* inputs,
+                                                const int32_t* inputLengths,
+                                                uint8_t* const* outputs,
+                                                uint8_t* const* tags,
+                                                int32_t tagLength,
+                                                int32_t operationCount)
+{
+    if (nonceLength > 0 && !EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, nonceLength, NULL))
+    {
+        return 0;
+    }
+
+    int32_t completed = 0;
+    while (completed < operationCount)
+    {
+        if (!GcmTransformOne(ctx,
+                             enc,
+                             nonces[completed],
+                             aads == NULL ? NULL : aads[completed],
+                             aadLengths == NULL ? 0 : aadLengths[completed],
+                             inputs[completed],
+                             inputLengths[completed],
+                             outputs[completed],
+                             tags[completed],
+                             tagLength))
+        {
+            break;
+        }
+
+        completed++;
+    }
+
+    return completed;
+}
+
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb()
 {
     return EVP_aes_128_ecb();
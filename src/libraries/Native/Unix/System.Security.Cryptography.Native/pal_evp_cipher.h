@@ -110,6 +110,32 @@ Sets tag for authenticated decryption
 */
 PALEXPORT int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32_t tagLength);
 
+/*
+Function:
+EvpCipherGcmTransformBatch
+
+Performs a sequence of complete GCM operations (nonce + optional AAD + payload +
+tag) against an already-keyed cipher context in a single native call, resetting
+the context between operations. For encryption the tag for each operation is
+written to tags[i]; for decryption tags[i] is the expected tag and a mismatch
+stops the batch.
+
+Returns the number of operations completed successfully; a value less than
+operationCount indicates the operation at that index failed.
+*/
+PALEXPORT int32_t CryptoNative_EvpCipherGcmTransformBatch(EVP_CIPHER_CTX* ctx,
+                                                          int32_t enc,
+                                                          uint8_t* const* nonces,
+                                                          int32_t nonceLength,
+                                                          uint8_t* const* aads,
+                                                          const int32_t* aadLengths,
+                                                          uint8_t* const* inputs,
+                                                          const int32_t* inputLengths,
+                                                          uint8_t* const* outputs,
+                                                          uint8_t* const* tags,
+                                                          int32_t tagLength,
+                                                          int32_t operationCount);
+
 /*
 Function:
 EvpAes128Ecb
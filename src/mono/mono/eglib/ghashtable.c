@@ -41,6 +41,25 @@ struct _Slot {
 
 static gpointer KEYMARKER_REMOVED = &KEYMARKER_REMOVED;
 
+/*
+ * Slots are carved out of blocks owned by the table instead of being
+ * malloced one by one: metadata loading fills tables with thousands of
+ * entries and the per-entry allocator traffic is measurable on startup.
+ * Blocks start small and double up to a cap so tiny tables stay cheap.
+ * Removed slots go on a free list for reuse; block memory is only
+ * returned when the table is destroyed.
+ */
+typedef struct _SlotBlock SlotBlock;
+
+struct _SlotBlock {
+	SlotBlock *next;
+	int size;
+	Slot slots [1];
+};
+
+#define SLOT_BLOCK_MIN_SIZE 4
+#define SLOT_BLOCK_MAX_SIZE 1024
+
 struct _GHashTable {
 	GHashFunc      hash_func;
 	GEqualFunc     key_equal_func;
@@ -50,6 +69,9 @@ struct _GHashTable {
 	int   in_use;
 	int   threshold;
 	int   last_rehash;
+	Slot *slot_free_list;
+	SlotBlock *slot_blocks;
+	int   slot_block_used;
 	GDestroyNotify value_destroy_func, key_destroy_func;
 };
 
@@ -106,6 +128,35 @@ g_spaced_primes_closest (guint x)
 	return calc_prime (x);
 }
 
+static Slot*
+slot_alloc (GHashTable *hash)
+{
+	Slot *s = hash->slot_free_list;
+
+	if (s != NULL) {
+		hash->slot_free_list = s->next;
+		return s;
+	}
+
+	if (hash->slot_blocks == NULL || hash->slot_block_used == hash->slot_blocks->size) {
+		int size = hash->slot_blocks ? MIN (hash->slot_blocks->size * 2, SLOT_BLOCK_MAX_SIZE) : SLOT_BLOCK_MIN_SIZE;
+		SlotBlock *block = (SlotBlock *) g_malloc (sizeof (SlotBlock) + (size - 1) * sizeof (Slot));
+
+		block->next = hash->slot_blocks;
+		block->size = size;
+		hash->slot_blocks = block;
+		hash->slot_block_used = 0;
+	}
+	return &hash->slot_blocks->slots [hash->slot_block_used++];
+}
+
+static void
+slot_free (GHashTable *hash, Slot *s)
+{
+	s->next = hash->slot_free_list;
+	hash->slot_free_list = s;
+}
+
 GHashTable *
 g_hash_table_new (GHashFunc hash_func, GEqualFunc key_equal_func)
 {
@@ -257,7 +308,7 @@ g_hash_table_insert_replace (GHashTable *hash, gpointer key, gpointer value, gbo
 			return;
 		}
 	}
-	s = g_new (Slot, 1);
+	s = slot_alloc (hash);
 	s->key = key;
 	s->value = value;
 	s->next = hash->table [hashcode];
@@ -423,7 +474,7 @@ g_hash_table_remove (GHashTable *hash, gconstpointer key)
 				hash->table [hashcode] = s->next;
 			else
 				last->next = s->next;
-			g_free (s);
+			slot_free (hash, s);
 			hash->in_use--;
 			sanity_check (hash);
 			return TRUE;
@@ -463,7 +514,7 @@ g_hash_table_foreach_remove (GHashTable *hash, GHRFunc func, gpointer user_data)
 					last->next = s->next;
 					n = last->next;
 				}
-				g_free (s);
+				slot_free (hash, s);
 				hash->in_use--;
 				count++;
 				s = n;
@@ -498,7 +549,7 @@ g_hash_table_steal (GHashTable *hash, gconstpointer key)
 				hash->table [hashcode] = s->next;
 			else
 				last->next = s->next;
-			g_free (s);
+			slot_free (hash, s);
 			hash->in_use--;
 			sanity_check (hash);
 			return TRUE;
@@ -535,7 +586,7 @@ g_hash_table_foreach_steal (GHashTable *hash, GHRFunc func, gpointer user_data)
 					last->next = s->next;
 					n = last->next;
 				}
-				g_free (s);
+				slot_free (hash, s);
 				hash->in_use--;
 				count++;
 				s = n;
@@ -564,16 +615,20 @@ g_hash_table_destroy (GHashTable *hash)
 
 		for (s = hash->table [i]; s != NULL; s = next){
 			next = s->next;
-			
+
 			if (hash->key_destroy_func != NULL)
 				(*hash->key_destroy_func)(s->key);
 			if (hash->value_destroy_func != NULL)
 				(*hash->value_destroy_func)(s->value);
-			g_free (s);
 		}
 	}
+	while (hash->slot_blocks != NULL) {
+		SlotBlock *next_block = hash->slot_blocks->next;
+		g_free (hash->slot_blocks);
+		hash->slot_blocks = next_block;
+	}
 	g_free (hash->table);
-	
+
 	g_free (hash);
 }
 
@@ -803,6 +803,68 @@ g_unichar_to_utf16 (gunichar c, gunichar2 *outbuf)
 	}
 }
 
+/*
+ * Strings crossing the embedding and marshaling boundaries are overwhelmingly
+ * ASCII, so the converters below bulk-advance over ASCII runs a word at a time
+ * and only fall back to full decoding on a non-ASCII (or nul) byte. The word
+ * loops compile down to SIMD on the targets we care about; the explicit
+ * memcpy keeps the loads alignment- and aliasing-safe.
+ */
+
+/* Length in bytes of the leading run of 0x01-0x7f bytes. */
+static FORCE_INLINE (size_t)
+utf8_ascii_run_length (const char *inptr, size_t inleft)
+{
+	const gsize ones = (gsize) 0x0101010101010101ULL;
+	const gsize highs = (gsize) 0x8080808080808080ULL;
+	size_t i = 0;
+	gsize w;
+
+	while (i + sizeof (gsize) <= inleft) {
+		memcpy (&w, inptr + i, sizeof (gsize));
+		if ((w & highs) != 0 || ((w - ones) & ~w & highs) != 0)
+			break;
+		i += sizeof (gsize);
+	}
+
+	while (i < inleft) {
+		guchar b = (guchar) inptr[i];
+		if (b == 0 || b >= 0x80)
+			break;
+		i++;
+	}
+
+	return i;
+}
+
+/* Length in bytes of the leading run of UTF-16 units in 0x0001-0x007f. */
+static FORCE_INLINE (size_t)
+utf16_ascii_run_length (const char *inptr, size_t inleft)
+{
+	const gsize ones = (gsize) 0x0001000100010001ULL;
+	const gsize highs = (gsize) 0x8000800080008000ULL;
+	const gsize nonascii = (gsize) 0xff80ff80ff80ff80ULL;
+	size_t i = 0;
+	gunichar2 u;
+	gsize w;
+
+	while (i + sizeof (gsize) <= inleft) {
+		memcpy (&w, inptr + i, sizeof (gsize));
+		if ((w & nonascii) != 0 || ((w - ones) & ~w & highs) != 0)
+			break;
+		i += sizeof (gsize);
+	}
+
+	while (i + 2 <= inleft) {
+		memcpy (&u, inptr + i, 2);
+		if (u == 0 || u >= 0x80)
+			break;
+		i += 2;
+	}
+
+	return i;
+}
+
 gunichar *
 g_utf8_to_ucs4_fast (const gchar *str, glong len, glong *items_written)
 {
@@ -835,11 +897,12 @@ eg_utf8_to_utf16_general (const gchar *str, glong len, glong *items_read, glong
 {
 	gunichar2 *outbuf, *outptr;
 	size_t outlen = 0;
+	size_t ascii, i;
 	size_t inleft;
 	char *inptr;
 	gunichar c;
 	int u, n;
-	
+
 	g_return_val_if_fail (str != NULL, NULL);
 	
 	if (len < 0) {
@@ -855,12 +918,21 @@ eg_utf8_to_utf16_general (const gchar *str, glong len, glong *items_read, glong
 	inleft = len;
 	
 	while (inleft > 0) {
+		/* One UTF-16 unit per ASCII byte; a nul byte stops the run, so the
+		 * scalar path below still decides how nuls are treated. */
+		if ((ascii = utf8_ascii_run_length (inptr, inleft)) > 0) {
+			outlen += ascii;
+			inleft -= ascii;
+			inptr += ascii;
+			continue;
+		}
+
 		if ((n = decode_utf8 (inptr, inleft, &c)) < 0)
 			goto error;
-		
+
 		if (c == 0 && !include_nuls)
 			break;
-		
+
 		if ((u = g_unichar_to_utf16 (c, NULL)) < 0) {
 			if (replace_invalid_codepoints) {
 				u = 2;
@@ -895,12 +967,21 @@ eg_utf8_to_utf16_general (const gchar *str, glong len, glong *items_read, glong
 	inleft = len;
 	
 	while (inleft > 0) {
+		if ((ascii = utf8_ascii_run_length (inptr, inleft)) > 0) {
+			for (i = 0; i < ascii; i++)
+				outptr[i] = (gunichar2) (guchar) inptr[i];
+			outptr += ascii;
+			inleft -= ascii;
+			inptr += ascii;
+			continue;
+		}
+
 		if ((n = decode_utf8 (inptr, inleft, &c)) < 0)
 			break;
-		
+
 		if (c == 0 && !include_nuls)
 			break;
-		
+
 		u = g_unichar_to_utf16 (c, outptr);
 		if ((u < 0) && replace_invalid_codepoints) {
 			outptr[0] = 0xFFFD;
@@ -1042,10 +1123,12 @@ eg_utf16_to_utf8_general (const gunichar2 *str, glong len, glong *items_read, gl
 {
 	char *inptr, *outbuf, *outptr;
 	size_t outlen = 0;
+	size_t ascii, i;
 	size_t inleft;
+	gunichar2 u;
 	gunichar c;
 	int n;
-	
+
 	g_return_val_if_fail (str != NULL, NULL);
 	
 	if (len < 0) {
@@ -1058,13 +1141,22 @@ eg_utf16_to_utf8_general (const gunichar2 *str, glong len, glong *items_read, gl
 	inleft = len * 2;
 	
 	while (inleft > 0) {
+		/* One UTF-8 byte per ASCII unit; a nul unit stops the run and
+		 * terminates in the scalar path below as before. */
+		if ((ascii = utf16_ascii_run_length (inptr, inleft)) > 0) {
+			outlen += ascii / 2;
+			inleft -= ascii;
+			inptr += ascii;
+			continue;
+		}
+
 		if ((n = decode_utf16 (inptr, inleft, &c)) < 0) {
 			if (n == -2 && inleft > 2) {
 				/* This means that the first UTF-16 char was read, but second failed */
 				inleft -= 2;
 				inptr += 2;
 			}
-			
+
 			if (errno == EILSEQ) {
 				g_set_error (err, G_CONVERT_ERROR, G_CONVERT_ERROR_ILLEGAL_SEQUENCE,
 					     "Illegal byte sequence encounted in the input.");
@@ -1075,25 +1167,25 @@ eg_utf16_to_utf8_general (const gunichar2 *str, glong len, glong *items_read, gl
 				g_set_error (err, G_CONVERT_ERROR, G_CONVERT_ERROR_PARTIAL_INPUT,
 					     "Partial byte sequence encountered in the input.");
 			}
-			
+
 			if (items_read)
 				*items_read = (inptr - (char *) str) / 2;
-			
+
 			if (items_written)
 				*items_written = 0;
-			
+
 			return NULL;
 		} else if (c == 0)
 			break;
-		
+
 		outlen += g_unichar_to_utf8 (c, NULL);
 		inleft -= n;
 		inptr += n;
 	}
-	
+
 	if (items_read)
 		*items_read = (inptr - (char *) str) / 2;
-	
+
 	if (items_written)
 		*items_written = outlen;
 
@@ -1113,18 +1205,28 @@ eg_utf16_to_utf8_general (const gunichar2 *str, glong len, glong *items_read, gl
 	inleft = len * 2;
 	
 	while (inleft > 0) {
+		if ((ascii = utf16_ascii_run_length (inptr, inleft)) > 0) {
+			for (i = 0; i < ascii; i += 2) {
+				memcpy (&u, inptr + i, 2);
+				*outptr++ = (gchar) u;
+			}
+			inleft -= ascii;
+			inptr += ascii;
+			continue;
+		}
+
 		if ((n = decode_utf16 (inptr, inleft, &c)) < 0)
 			break;
 		else if (c == 0)
 			break;
-		
+
 		outptr += g_unichar_to_utf8 (c, outptr);
 		inleft -= n;
 		inptr += n;
 	}
-	
+
 	*outptr = '\0';
-	
+
 	return outbuf;
 }
 
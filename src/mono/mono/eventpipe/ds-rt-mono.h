@@ -263,6 +263,28 @@ ds_rt_set_environment_variable (const ep_char16_t *name, const ep_char16_t *valu
 	return success ? DS_IPC_S_OK : DS_IPC_E_FAIL;
 }
 
+/*
+* StressLog.
+*/
+
+static
+inline
+uint32_t
+ds_rt_stress_log_collect (
+	uint8_t **buffer,
+	uint32_t *buffer_len)
+{
+	// Mono has no stress log to snapshot.
+	return DS_IPC_E_NOTSUPPORTED;
+}
+
+static
+inline
+void
+ds_rt_stress_log_free (uint8_t *buffer)
+{
+}
+
 /*
 * DiagnosticServer.
 */
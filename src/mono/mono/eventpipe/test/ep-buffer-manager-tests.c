@@ -43,9 +43,17 @@ null_stream_writer_write_func (
 	return true;
 }
 
+static
+bool
+null_stream_writer_flush_func (void *stream)
+{
+	return true;
+}
+
 static StreamWriterVtable null_stream_writer_vtable = {
 	null_stream_writer_free_func,
-	null_stream_writer_write_func };
+	null_stream_writer_write_func,
+	null_stream_writer_flush_func };
 
 static
 void
@@ -44,9 +44,17 @@ memory_stream_writer_write_func (
 	return true;
 }
 
+static
+bool
+memory_stream_writer_flush_func (void *stream)
+{
+	return true;
+}
+
 static StreamWriterVtable memory_stream_writer_vtable = {
 	memory_stream_writer_free_func,
-	memory_stream_writer_write_func };
+	memory_stream_writer_write_func,
+	memory_stream_writer_flush_func };
 
 static RESULT
 test_fast_serializer_object_fast_serialize (void)
@@ -498,8 +498,8 @@ mini_regression_step (MonoImage *image, int verbose, int *total_run, int *total,
 	MonoJitMemoryManager *jit_mm = get_default_jit_mm ();
 	g_hash_table_destroy (jit_mm->jit_trampoline_hash);
 	jit_mm->jit_trampoline_hash = g_hash_table_new (mono_aligned_addr_hash, NULL);
-	mono_internal_hash_table_destroy (&(jit_mm->jit_code_hash));
-	mono_jit_code_hash_init (&(jit_mm->jit_code_hash));
+	mono_conc_hashtable_destroy (jit_mm->jit_code_hash);
+	jit_mm->jit_code_hash = mono_conc_hashtable_new (mono_aligned_addr_hash, NULL);
 
 	g_timer_start (timer);
 	if (mini_stats_fd)
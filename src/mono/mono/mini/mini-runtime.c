@@ -1807,7 +1807,7 @@ mini_init_gsctx (MonoMemPool *mp, MonoGenericContext *context, MonoGenericSharin
 }
 
 /*
- * LOCKING: Acquires the jit code hash lock.
+ * LOCKING: The lookups are lock free, writers to the code hash hold the jit code hash lock.
  */
 MonoJitInfo*
 mini_lookup_method (MonoMethod *method, MonoMethod *shared)
@@ -1818,27 +1818,27 @@ mini_lookup_method (MonoMethod *method, MonoMethod *shared)
 	static int lookups = 0;
 	static int failed_lookups = 0;
 
-	jit_code_hash_lock (jit_mm);
-	ji = (MonoJitInfo *)mono_internal_hash_table_lookup (&jit_mm->jit_code_hash, method);
-	jit_code_hash_unlock (jit_mm);
+	ji = (MonoJitInfo *)mono_conc_hashtable_lookup (jit_mm->jit_code_hash, method);
 	if (!ji && shared) {
 		jit_mm = jit_mm_for_method (shared);
 
-		jit_code_hash_lock (jit_mm);
 		/* Try generic sharing */
-		ji = (MonoJitInfo *)mono_internal_hash_table_lookup (&jit_mm->jit_code_hash, shared);
+		ji = (MonoJitInfo *)mono_conc_hashtable_lookup (jit_mm->jit_code_hash, shared);
 		if (ji && !ji->has_generic_jit_info)
 			ji = NULL;
 		if (!inited) {
-			mono_counters_register ("Shared generic lookups", MONO_COUNTER_INT|MONO_COUNTER_GENERICS, &lookups);
-			mono_counters_register ("Failed shared generic lookups", MONO_COUNTER_INT|MONO_COUNTER_GENERICS, &failed_lookups);
-			inited = TRUE;
+			jit_code_hash_lock (jit_mm);
+			if (!inited) {
+				mono_counters_register ("Shared generic lookups", MONO_COUNTER_INT|MONO_COUNTER_GENERICS, &lookups);
+				mono_counters_register ("Failed shared generic lookups", MONO_COUNTER_INT|MONO_COUNTER_GENERICS, &failed_lookups);
+				inited = TRUE;
+			}
+			jit_code_hash_unlock (jit_mm);
 		}
 
 		++lookups;
 		if (!ji)
 			++failed_lookups;
-		jit_code_hash_unlock (jit_mm);
 	}
 
 	return ji;
@@ -2795,7 +2795,7 @@ mono_jit_free_method (MonoMethod *method)
 	jit_mm = jit_mm_for_method (method);
 
 	jit_code_hash_lock (jit_mm);
-	removed = mono_internal_hash_table_remove (&jit_mm->jit_code_hash, method);
+	removed = mono_conc_hashtable_remove (jit_mm->jit_code_hash, method) != NULL;
 	g_assert (removed);
 	jit_code_hash_unlock (jit_mm);
 
@@ -4120,7 +4120,7 @@ init_jit_mem_manager (MonoMemoryManager *mem_manager)
 	info->seq_points = g_hash_table_new_full (mono_aligned_addr_hash, NULL, NULL, mono_seq_point_info_free);
 	info->runtime_invoke_hash = mono_conc_hashtable_new_full (mono_aligned_addr_hash, NULL, NULL, runtime_invoke_info_free);
 	info->arch_seq_points = g_hash_table_new (mono_aligned_addr_hash, NULL);
-	mono_jit_code_hash_init (&info->jit_code_hash);
+	info->jit_code_hash = mono_conc_hashtable_new (mono_aligned_addr_hash, NULL);
 	mono_jit_code_hash_init (&info->interp_code_hash);
 	mono_os_mutex_init_recursive (&info->jit_code_hash_lock);
 
@@ -4200,6 +4200,7 @@ free_jit_mem_manager (MonoMemoryManager *mem_manager)
 		g_hash_table_foreach (info->llvm_jit_callees, free_jit_callee_list, NULL);
 		g_hash_table_destroy (info->llvm_jit_callees);
 	}
+	mono_conc_hashtable_destroy (info->jit_code_hash);
 	mono_internal_hash_table_destroy (&info->interp_code_hash);
 #ifdef ENABLE_LLVM
 	mono_llvm_free_mem_manager (info);
@@ -57,8 +57,8 @@ typedef struct {
 	GHashTable *method_rgctx_hash;
 	/* Maps gpointer -> InterpMethod */
 	GHashTable *interp_method_pointer_hash;
-	/* Protected by 'jit_code_hash_lock' */
-	MonoInternalHashTable jit_code_hash;
+	/* Maps MonoMethod -> MonoJitInfo. Lookups are lock free, writers must hold 'jit_code_hash_lock' */
+	MonoConcurrentHashTable *jit_code_hash;
 	mono_mutex_t    jit_code_hash_lock;
 } MonoJitMemoryManager;
 
@@ -3312,6 +3312,17 @@ mini_method_compile (MonoMethod *method, guint32 opts, JitFlags flags, int parts
 		return cfg;
 	}
 
+	/*
+	 * Tiny methods (property accessors and the like) dominate startup JIT time and
+	 * get no measurable code quality from the global passes: skip SSA based opts,
+	 * alias analysis and global liveness/linear scan for them and let the local
+	 * register allocator do the job. Leave MONO_OPT_LOOP alone since coop
+	 * safepoint insertion depends on it. AOT keeps the full pipeline, there
+	 * compile time is not user visible.
+	 */
+	if (!cfg->compile_aot && !COMPILE_LLVM (cfg) && header->code_size <= 64 && header->num_clauses == 0)
+		cfg->opt &= ~(MONO_OPT_LINEARS | MONO_OPT_ALIAS_ANALYSIS | MONO_OPT_SSA | MONO_OPT_ABCREM);
+
 #ifdef ENABLE_LLVM
 	{
 		static gboolean inited;
@@ -4195,9 +4206,9 @@ mono_jit_compile_method_inner (MonoMethod *method, int opt, MonoError *error)
 	if (code == NULL) {
 		MonoJitMemoryManager *jit_mm = (MonoJitMemoryManager*)cfg->jit_mm;
 
-		/* The lookup + insert is atomic since this is done inside the domain lock */
+		/* The insert is serialized with other writers by the jit code hash lock */
 		jit_code_hash_lock (jit_mm);
-		mono_internal_hash_table_insert (&jit_mm->jit_code_hash, cfg->jit_info->d.method, cfg->jit_info);
+		mono_conc_hashtable_insert (jit_mm->jit_code_hash, cfg->jit_info->d.method, cfg->jit_info);
 		jit_code_hash_unlock (jit_mm);
 
 		code = cfg->native_code;
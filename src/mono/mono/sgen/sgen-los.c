@@ -52,6 +52,14 @@
 
 #define LOS_NUM_FAST_SIZES		32
 
+/*
+ * Coalesced free runs at least this large have their pages (minus the one
+ * holding the free-list header) returned to the OS at sweep time, so the
+ * footprint of partially used sections doesn't ratchet with the high
+ * watermark of past allocations.
+ */
+#define LOS_DISCARD_WATERMARK		(8 * LOS_CHUNK_SIZE)
+
 typedef struct _LOSFreeChunks LOSFreeChunks;
 struct _LOSFreeChunks {
 	LOSFreeChunks *next_size;
@@ -548,10 +556,16 @@ sgen_los_sweep (void)
 
 		for (i = 0; i <= LOS_SECTION_NUM_CHUNKS; ++i) {
 			if (section->free_chunk_map [i]) {
+				LOSFreeChunks *free_chunks = (LOSFreeChunks*)((char*)section + (i << LOS_CHUNK_BITS));
+				size_t run_size;
 				int j;
 				for (j = i + 1; j <= LOS_SECTION_NUM_CHUNKS && section->free_chunk_map [j]; ++j)
 					;
-				add_free_chunk ((LOSFreeChunks*)((char*)section + (i << LOS_CHUNK_BITS)), (j - i) << LOS_CHUNK_BITS);
+				run_size = (size_t)(j - i) << LOS_CHUNK_BITS;
+				add_free_chunk (free_chunks, run_size);
+				/* The first bytes hold the free-list header we just wrote, keep them */
+				if (run_size >= LOS_DISCARD_WATERMARK)
+					sgen_discard_os_memory ((char*)free_chunks + sizeof (LOSFreeChunks), run_size - sizeof (LOSFreeChunks));
 				i = j - 1;
 			}
 		}
@@ -2645,6 +2645,14 @@ scan_card_table_for_block (MSBlockInfo *block, CardTableScanType scan_type, Scan
 		sgen_binary_protocol_card_scan (first_obj, end - first_obj);
 
 		while (obj < end) {
+			/*
+			 * Scanning an object starts with two dependent loads (vtable, then
+			 * descriptor). Prefetch the next object's header while we work on
+			 * this one; past the last object this prefetches the block end,
+			 * which is harmless.
+			 */
+			PREFETCH_READ (obj + block_obj_size);
+
 			if (obj < scan_front || !MS_OBJ_ALLOCED_FAST (obj, block_start))
 				goto next_object;
 
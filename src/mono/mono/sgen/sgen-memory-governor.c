@@ -462,6 +462,22 @@ sgen_free_os_memory (void *addr, size_t size, SgenAllocFlags flags, MonoMemAccou
 	total_alloc_max = MAX (total_alloc_max, total_alloc);
 }
 
+/*
+ * Return the physical pages backing a range allocated with sgen_alloc_os_memory ()
+ * to the OS without unmapping it. The range reads back as zeroes when touched
+ * again. Partial pages at either end are left alone.
+ */
+void
+sgen_discard_os_memory (void *addr, size_t size)
+{
+	size_t pagesize = mono_pagesize ();
+	mword start = SGEN_ALIGN_UP_TO ((mword)addr, pagesize);
+	mword end = SGEN_ALIGN_DOWN_TO ((mword)addr + size, pagesize);
+
+	if (start < end)
+		mono_mprotect ((void*)start, end - start, MONO_MMAP_DISCARD | MONO_MMAP_READ | MONO_MMAP_WRITE);
+}
+
 size_t
 sgen_gc_get_total_heap_allocation (void)
 {
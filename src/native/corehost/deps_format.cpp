@@ -199,6 +199,15 @@ bool deps_json_t::perform_rid_fallback(rid_specific_assets_t* portable_assets, c
 bool deps_json_t::process_runtime_targets(const json_parser_t::value_t& json, const pal::string_t& target_name, const rid_fallback_graph_t& rid_fallback_graph, rid_specific_assets_t* p_assets)
 {
     rid_specific_assets_t& assets = *p_assets;
+
+    // Precompute the set of RIDs that can possibly be selected for this host: the host RID
+    // itself plus its fallbacks. Assets for any other RID would only be materialized so that
+    // perform_rid_fallback can erase them again, which is wasted work on RID-heavy deps files.
+    // When the host RID is not in the fallback graph nothing is filtered, so the
+    // "framework does not support the runtime" diagnostics in perform_rid_fallback stay intact.
+    const pal::string_t host_rid = get_current_rid(rid_fallback_graph);
+    const auto host_rid_fallbacks = rid_fallback_graph.find(host_rid);
+
     for (const auto& package : json[_X("targets")][target_name.c_str()].GetObject())
     {
         const auto& runtimeTargets = package.value.FindMember(_X("runtimeTargets"));
@@ -218,6 +227,15 @@ bool deps_json_t::process_runtime_targets(const json_parser_t::value_t& json, co
                     continue;
                 }
 
+                const auto& rid = file.value[_X("rid")].GetString();
+
+                if (host_rid_fallbacks != rid_fallback_graph.end() &&
+                    host_rid.compare(rid) != 0 &&
+                    std::find(host_rid_fallbacks->second.begin(), host_rid_fallbacks->second.end(), rid) == host_rid_fallbacks->second.end())
+                {
+                    continue;
+                }
+
                 version_t assembly_version, file_version;
 
                 const pal::string_t& assembly_version_str = get_optional_property(file.value, _X("assemblyVersion"));
@@ -235,8 +253,6 @@ bool deps_json_t::process_runtime_targets(const json_parser_t::value_t& json, co
                 pal::string_t file_name{file.name.GetString()};
                 deps_asset_t asset(get_filename_without_ext(file_name), file_name, assembly_version, file_version);
 
-                const auto& rid = file.value[_X("rid")].GetString();
-
                 if (trace::is_enabled())
                 {
                     trace::info(_X("Adding runtimeTargets %s asset %s rid=%s assemblyVersion=%s fileVersion=%s from %s"),
@@ -190,7 +190,8 @@ namespace
     fx_definition_t* resolve_framework_reference(
         const fx_reference_t & fx_ref,
         const pal::string_t & oldest_requested_version,
-        const pal::string_t & dotnet_dir)
+        const pal::string_t & dotnet_dir,
+        std::unordered_map<pal::string_t, std::vector<fx_ver_t>> & version_dir_cache)
     {
 #if defined(DEBUG)
         assert(!fx_ref.get_fx_name().empty());
@@ -244,20 +245,31 @@ namespace
             }
             else
             {
-                std::vector<pal::string_t> list;
-                std::vector<fx_ver_t> version_list;
-                pal::readdir_onlydirectories(fx_dir, &list);
-
-                for (const auto& version : list)
+                // The resolution algorithm can visit the same framework directory several
+                // times - once per reference to the framework and once more per restart
+                // after a reference reconciliation. The directory contents can't change
+                // meaningfully within a single resolution, so enumerate it at most once
+                // per app launch.
+                auto cached_versions = version_dir_cache.find(fx_dir);
+                if (cached_versions == version_dir_cache.end())
                 {
-                    fx_ver_t ver;
-                    if (fx_ver_t::parse(version, &ver, false))
+                    std::vector<pal::string_t> list;
+                    std::vector<fx_ver_t> parsed_versions;
+                    pal::readdir_onlydirectories(fx_dir, &list);
+
+                    for (const auto& version : list)
                     {
-                        version_list.push_back(ver);
+                        fx_ver_t ver;
+                        if (fx_ver_t::parse(version, &ver, false))
+                        {
+                            parsed_versions.push_back(ver);
+                        }
                     }
+
+                    cached_versions = version_dir_cache.emplace(fx_dir, std::move(parsed_versions)).first;
                 }
 
-                fx_ver_t resolved_ver = resolve_framework_reference_from_version_list(version_list, fx_ref);
+                fx_ver_t resolved_ver = resolve_framework_reference_from_version_list(cached_versions->second, fx_ref);
 
                 pal::string_t resolved_ver_str = resolved_ver.as_str();
                 append_path(&fx_dir, resolved_ver_str.c_str());
@@ -439,7 +451,7 @@ StatusCode fx_resolver_t::read_framework(
             m_effective_fx_references[fx_name] = new_effective_fx_ref;
 
             // Resolve the effective framework reference against the the existing physical framework folders
-            fx_definition_t* fx = resolve_framework_reference(new_effective_fx_ref, m_oldest_fx_references[fx_name].get_fx_version(), host_info.dotnet_root);
+            fx_definition_t* fx = resolve_framework_reference(new_effective_fx_ref, m_oldest_fx_references[fx_name].get_fx_version(), host_info.dotnet_root, m_version_dir_cache);
             if (fx == nullptr)
             {
                 display_missing_framework_error(fx_name, new_effective_fx_ref.get_fx_version(), pal::string_t(), host_info.dotnet_root);
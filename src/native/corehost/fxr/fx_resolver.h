@@ -78,6 +78,12 @@ private:
     // to fill the "oldest reference" for each resolved framework in the end. It does not affect the behavior
     // of the algorithm.
     fx_name_to_fx_reference_map_t m_oldest_fx_references;
+
+    // Map of framework directory -> parsed version sub-directories found in it. The resolution algorithm restarts
+    // whenever reconciliation updates an already resolved reference and it may also consider the same framework
+    // directory for several references, so without this the same directory would be enumerated over and over
+    // within a single launch. The lifetime of the cache is one resolution, so staleness is not a concern.
+    std::unordered_map<pal::string_t, std::vector<fx_ver_t>> m_version_dir_cache;
 };
 
 #endif // __FX_RESOLVER_H__
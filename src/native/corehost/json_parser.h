@@ -12,6 +12,18 @@
 #define RAPIDJSON_48BITPOINTER_OPTIMIZATION 0
 #endif
 
+// RapidJSON ships SIMD specializations of its whitespace skipping, but they are opt-in.
+// Enable them where the instructions are part of the baseline ISA for the host, so every
+// parse that goes through this wrapper (deps.json, runtimeconfig.json, bundle-embedded
+// copies of both) benefits without a runtime dispatch. The SIMD loops read in aligned
+// 16-byte blocks, so they never cross a page boundary past the buffer: the buffers here
+// are either null-terminated (realloc_buffer) or part of a larger file mapping (bundle).
+#if defined(TARGET_AMD64)
+#define RAPIDJSON_SSE2
+#elif defined(TARGET_ARM64)
+#define RAPIDJSON_NEON
+#endif
+
 #include "pal.h"
 #include "rapidjson/document.h"
 #include "rapidjson/fwd.h"
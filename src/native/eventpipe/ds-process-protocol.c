@@ -77,6 +77,19 @@ process_protocol_helper_set_environment_variable (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+bool
+stress_log_size_payload_flatten (
+	void *payload,
+	uint8_t **buffer,
+	uint16_t *size);
+
+static
+bool
+process_protocol_helper_get_stress_log (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
 static
 bool
 process_protocol_helper_unknown_command (
@@ -747,6 +760,83 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+bool
+stress_log_size_payload_flatten (
+	void *payload,
+	uint8_t **buffer,
+	uint16_t *size)
+{
+	uint32_t *blob_len = (uint32_t *)payload;
+
+	EP_ASSERT (payload != NULL);
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (*buffer != NULL);
+	EP_ASSERT (size != NULL);
+	EP_ASSERT (*size == sizeof (uint32_t));
+
+	// uint32_t blob_len;
+	memcpy (*buffer, blob_len, sizeof (uint32_t));
+	*buffer += sizeof (uint32_t);
+	*size -= sizeof (uint32_t);
+
+	// Assert we've used the whole buffer we were given
+	EP_ASSERT (*size == 0);
+
+	return true;
+}
+
+static
+bool
+process_protocol_helper_get_stress_log (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	EP_ASSERT (message != NULL);
+	EP_ASSERT (stream != NULL);
+
+	bool result = false;
+	uint8_t *blob = NULL;
+	uint32_t blob_len = 0;
+	uint32_t bytes_written = 0;
+	ds_ipc_result_t ipc_result;
+
+	// The runtime owns the snapshot buffer; it is released on all paths below.
+	ipc_result = ds_rt_stress_log_collect (&blob, &blob_len);
+	if (ipc_result != DS_IPC_S_OK) {
+		ds_ipc_message_send_error (stream, ipc_result);
+		ep_raise_error ();
+	}
+
+	// The response payload carries only the blob size; the blob itself is
+	// streamed afterwards, like the environment block of GET_PROCESS_ENV.
+	if (!ds_ipc_message_initialize_buffer (
+		message,
+		ds_ipc_header_get_generic_success (),
+		(void *)&blob_len,
+		(uint16_t)sizeof (blob_len),
+		stress_log_size_payload_flatten)) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_FAIL);
+		ep_raise_error ();
+	}
+
+	ep_raise_error_if_nok (ds_ipc_message_send (message, stream));
+	ep_raise_error_if_nok (ds_ipc_stream_write (stream, blob, blob_len, &bytes_written, EP_INFINITE_WAIT));
+	ep_raise_error_if_nok (bytes_written == blob_len);
+
+	result = true;
+
+ep_on_exit:
+	ds_rt_stress_log_free (blob);
+	ds_ipc_stream_free (stream);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	DS_LOG_WARNING_0 ("Failed to send DiagnosticsIPC response");
+	ep_exit_error_handler ();
+}
+
 static
 bool
 process_protocol_helper_unknown_command (
@@ -785,6 +875,9 @@ ds_process_protocol_helper_handle_ipc_message (
 	case DS_PROCESS_COMMANDID_GET_PROCESS_INFO_2:
 		result = process_protocol_helper_get_process_info_2 (message, stream);
 		break;
+	case DS_PROCESS_COMMANDID_GET_STRESS_LOG:
+		result = process_protocol_helper_get_stress_log (message, stream);
+		break;
 	default:
 		result = process_protocol_helper_unknown_command (message, stream);
 		break;
@@ -154,6 +154,23 @@ ds_rt_get_environment_variable (const ep_char16_t *name,
 								uint32_t *valueLengthOut,
 								ep_char16_t *valueBuffer);
 
+/*
+* StressLog.
+*/
+
+// Snapshots the runtime's stress log rings into one contiguous buffer owned
+// by the runtime; release it with ds_rt_stress_log_free. Runtimes without a
+// stress log return DS_IPC_E_NOTSUPPORTED.
+static
+uint32_t
+ds_rt_stress_log_collect (
+	uint8_t **buffer,
+	uint32_t *buffer_len);
+
+static
+void
+ds_rt_stress_log_free (uint8_t *buffer);
+
 /*
 * DiagnosticServer.
 */
@@ -68,7 +68,8 @@ typedef enum {
 	DS_PROCESS_COMMANDID_RESUME_RUNTIME = 0x01,
 	DS_PROCESS_COMMANDID_GET_PROCESS_ENV = 0x02,
 	DS_PROCESS_COMMANDID_SET_ENV_VAR = 0x03,
-	DS_PROCESS_COMMANDID_GET_PROCESS_INFO_2 = 0x04
+	DS_PROCESS_COMMANDID_GET_PROCESS_INFO_2 = 0x04,
+	DS_PROCESS_COMMANDID_GET_STRESS_LOG = 0x05
 	// future
 } DiagnosticsProcessCommandId;
 
@@ -840,13 +840,13 @@ ep_buffer_manager_alloc (
 	instance->session = session;
 	instance->size_of_all_buffers = 0;
 	instance->num_oversized_events_dropped = 0;
+	ep_rt_volatile_store_int64_t (&instance->num_events_dropped, 0);
 
 #ifdef EP_CHECKED_BUILD
 	instance->num_buffers_allocated = 0;
 	instance->num_buffers_stolen = 0;
 	instance->num_buffers_leaked = 0;
 	instance->num_events_stored = 0;
-	ep_rt_volatile_store_int64_t (&instance->num_events_dropped, 0);
 	ep_rt_volatile_store_int64_t (&instance->num_events_written, 0);
 #endif
 
@@ -1041,12 +1041,13 @@ ep_buffer_manager_write_event (
 		// Indicate that there is new data to be read
 		ep_rt_wait_event_set (&buffer_manager->rt_wait_event);
 
+	if (!alloc_new_buffer) {
 #ifdef EP_CHECKED_BUILD
-	if (!alloc_new_buffer)
 		ep_rt_atomic_inc_int64_t (&buffer_manager->num_events_stored);
-	else
-		ep_rt_atomic_inc_int64_t (&buffer_manager->num_events_dropped);
 #endif
+	} else {
+		ep_rt_atomic_inc_int64_t (&buffer_manager->num_events_dropped);
+	}
 
 	result = !alloc_new_buffer;
 
@@ -1398,6 +1399,15 @@ ep_buffer_manager_get_next_event (EventPipeBufferManager *buffer_manager)
 	return buffer_manager->current_event;
 }
 
+int64_t
+ep_buffer_manager_get_dropped_event_count (EventPipeBufferManager *buffer_manager)
+{
+	EP_ASSERT (buffer_manager != NULL);
+
+	return ep_rt_volatile_load_int64_t (&buffer_manager->num_events_dropped) +
+		ep_rt_volatile_load_int64_t (&buffer_manager->num_oversized_events_dropped);
+}
+
 void
 ep_buffer_manager_deallocate_buffers (EventPipeBufferManager *buffer_manager)
 {
@@ -128,10 +128,12 @@ struct _EventPipeBufferManager_Internal {
 	// number of times an event was dropped due to it being too
 	// large to fit in the 64KB size limit
 	volatile int64_t num_oversized_events_dropped;
+	// number of times an event was dropped because a buffer could not be
+	// obtained for it (the session's buffer budget was exhausted)
+	volatile int64_t num_events_dropped;
 
 #ifdef EP_CHECKED_BUILD
 	volatile int64_t num_events_stored;
-	volatile int64_t num_events_dropped;
 	int64_t num_events_written;
 	uint32_t num_buffers_allocated;
 	uint32_t num_buffers_stolen;
@@ -232,6 +234,11 @@ ep_buffer_manager_write_all_buffers_to_file_v4 (
 EventPipeEventInstance *
 ep_buffer_manager_get_next_event (EventPipeBufferManager *buffer_manager);
 
+// Total number of events dropped so far, either because a buffer could not be
+// obtained for them or because they exceeded the maximum event size.
+int64_t
+ep_buffer_manager_get_dropped_event_count (EventPipeBufferManager *buffer_manager);
+
 // Attempt to de-allocate resources as best we can.  It is possible for some buffers to leak because
 // threads can be in the middle of a write operation and get blocked, and we may not get an opportunity
 // to free their buffer for a very long time.
@@ -83,8 +83,32 @@ ep_buffer_write_event (
 
 	bool success = true;
 
+	// Collect the stack first since the number of captured frames determines how much
+	// of the instance's frame array needs to be reserved in the buffer.
+	EventPipeStackContents stack_contents;
+	EventPipeStackContents *current_stack_contents;
+	current_stack_contents = ep_stack_contents_init (&stack_contents);
+	if (stack == NULL && ep_event_get_need_stack (ep_event) && !ep_session_get_rundown_enabled (session)) {
+		ep_walk_managed_stack_for_current_thread (current_stack_contents);
+		stack = current_stack_contents;
+	}
+
 	// Calculate the size of the event.
-	uint32_t event_size = sizeof (EventPipeEventInstance) + ep_event_payload_get_size (payload);
+	uint32_t instance_size = sizeof (EventPipeEventInstance);
+#ifndef EP_CHECKED_BUILD
+	// Reserve space only for the stack frames actually captured instead of
+	// EP_MAX_STACK_DEPTH for every event. Events without a payload keep the full
+	// layout because the read side locates their successor by skipping a whole
+	// instance; the checked build keeps it as well since its debug members live
+	// past the frame array and ep_buffer_ensure_consistency walks the buffer
+	// using the full instance size.
+	if (ep_event_payload_get_size (payload) != 0) {
+		uint32_t unused_frames = EP_MAX_STACK_DEPTH - (stack != NULL ? ep_stack_contents_get_length (stack) : 0);
+		instance_size -= (uint32_t)(unused_frames * sizeof (uintptr_t));
+	}
+#endif
+
+	uint32_t event_size = instance_size + ep_event_payload_get_size (payload);
 
 	// Make sure we have enough space to write the event.
 	if(buffer->current + event_size > buffer->limit)
@@ -92,15 +116,7 @@ ep_buffer_write_event (
 
 	// Calculate the location of the data payload.
 	uint8_t *data_dest;
-	data_dest = (ep_event_payload_get_size (payload) == 0 ? NULL : buffer->current + sizeof(EventPipeEventInstance));
-
-	EventPipeStackContents stack_contents;
-	EventPipeStackContents *current_stack_contents;
-	current_stack_contents = ep_stack_contents_init (&stack_contents);
-	if (stack == NULL && ep_event_get_need_stack (ep_event) && !ep_session_get_rundown_enabled (session)) {
-		ep_walk_managed_stack_for_current_thread (current_stack_contents);
-		stack = current_stack_contents;
-	}
+	data_dest = (ep_event_payload_get_size (payload) == 0 ? NULL : buffer->current + instance_size);
 
 	uint32_t proc_number;
 	proc_number = ep_rt_current_processor_get_number ();
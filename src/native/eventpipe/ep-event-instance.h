@@ -31,10 +31,9 @@ struct _EventPipeEventInstance_Internal {
 	uint32_t metadata_id;
 	uint32_t proc_num;
 	uint32_t data_len;
-	// TODO: Look at optimizing this when writing into buffer manager.
-	// Only write up to next available frame to better utilize memory.
-	// Even events not requesting a stack will still waste space in buffer manager.
-	// Needs to go last since number of frames will set size in stream.
+	// Needs to go last: instances written into the buffer manager reserve only
+	// the captured frames, truncating the unused tail of the frame array
+	// (see ep_buffer_write_event).
 	EventPipeStackContents stack_contents;
 #ifdef EP_CHECKED_BUILD
 	uint32_t debug_event_start;
@@ -11,6 +11,7 @@
 #include "ep-file.h"
 #include "ep-session.h"
 #include "ep-event-payload.h"
+#include "ep-user-events.h"
 #include "ep-rt.h"
 
 /*
@@ -137,7 +138,7 @@ ep_session_alloc (
 {
 	EP_ASSERT (index < EP_MAX_NUMBER_OF_SESSIONS);
 	EP_ASSERT (format < EP_SERIALIZATION_FORMAT_COUNT);
-	EP_ASSERT (session_type == EP_SESSION_TYPE_SYNCHRONOUS || circular_buffer_size_in_mb > 0);
+	EP_ASSERT (session_type == EP_SESSION_TYPE_SYNCHRONOUS || session_type == EP_SESSION_TYPE_USEREVENTS || circular_buffer_size_in_mb > 0);
 	EP_ASSERT (providers_len > 0);
 	EP_ASSERT (providers != NULL);
 	EP_ASSERT ((sync_callback != NULL) == (session_type == EP_SESSION_TYPE_SYNCHRONOUS));
@@ -168,7 +169,9 @@ ep_session_alloc (
 		sequence_point_alloc_budget = 10 * 1024 * 1024;
 	}
 
-	if (session_type != EP_SESSION_TYPE_SYNCHRONOUS) {
+	// Synchronous and user_events sessions deliver events on the emitting
+	// thread and never buffer.
+	if (session_type != EP_SESSION_TYPE_SYNCHRONOUS && session_type != EP_SESSION_TYPE_USEREVENTS) {
 		instance->buffer_manager = ep_buffer_manager_alloc (instance, ((size_t)circular_buffer_size_in_mb) << 20, sequence_point_alloc_budget);
 		ep_raise_error_if_nok (instance->buffer_manager != NULL);
 	}
@@ -195,6 +198,11 @@ ep_session_alloc (
 		ipc_stream_writer = NULL;
 		break;
 
+	case EP_SESSION_TYPE_USEREVENTS:
+		instance->user_events = ep_user_events_alloc ();
+		ep_raise_error_if_nok (instance->user_events != NULL);
+		break;
+
 	default:
 		break;
 	}
@@ -229,6 +237,7 @@ ep_session_free (EventPipeSession *session)
 
 	ep_buffer_manager_free (session->buffer_manager);
 	ep_file_free (session->file);
+	ep_user_events_free (session->user_events);
 
 	ep_rt_object_free (session);
 }
@@ -438,6 +447,12 @@ ep_session_write_all_buffers_to_file (EventPipeSession *session, bool *events_wr
 	// the current timestamp are written into the file.
 	ep_timestamp_t stop_timestamp = ep_perf_timestamp_get ();
 	ep_buffer_manager_write_all_buffers_to_file (session->buffer_manager, session->file, stop_timestamp, events_written);
+
+	// Push any bytes the stream writer coalesced out to the transport so
+	// streaming consumers observe the batch without waiting for the next one.
+	if (ep_file_get_fast_serializer (session->file) != NULL)
+		ep_fast_serializer_flush (ep_file_get_fast_serializer (session->file));
+
 	return !ep_file_has_errors (session->file);
 }
 
@@ -478,6 +493,11 @@ ep_session_write_event (
 				stack == NULL ? NULL : (uintptr_t *)ep_stack_contents_get_pointer (stack),
 				session->callback_additional_data);
 			result = true;
+		} else if (session->user_events != NULL) {
+			result = ep_user_events_write_event (
+				session->user_events,
+				ep_event,
+				payload);
 		} else {
 			EP_ASSERT (session->buffer_manager != NULL);
 			result = ep_buffer_manager_write_event (
@@ -510,6 +530,18 @@ ep_session_get_next_event (EventPipeSession *session)
 	return ep_buffer_manager_get_next_event (session->buffer_manager);
 }
 
+int64_t
+ep_session_get_dropped_event_count (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	// Synchronous sessions deliver events inline and never drop them.
+	if (!session->buffer_manager)
+		return 0;
+
+	return ep_buffer_manager_get_dropped_event_count (session->buffer_manager);
+}
+
 ep_rt_wait_event_handle_t *
 ep_session_get_wait_event (EventPipeSession *session)
 {
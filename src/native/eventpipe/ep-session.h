@@ -33,6 +33,8 @@ struct _EventPipeSession_Internal {
 	EventPipeBufferManager *buffer_manager;
 	// Object used to flush event data (File, IPC stream, etc.).
 	EventPipeFile *file;
+	// For user_events sessions, the tracepoint writer (Linux only).
+	EventPipeUserEvents *user_events;
 	// For synchoronous sessions.
 	EventPipeSessionSynchronousCallback synchronous_callback;
 	// Additional data to pass to the callback
@@ -166,6 +168,12 @@ ep_session_write_event (
 EventPipeEventInstance *
 ep_session_get_next_event (EventPipeSession *session);
 
+// Total number of events this session has dropped, either because a buffer
+// could not be obtained for them (buffer budget exhausted) or because they
+// exceeded the maximum event size. Always 0 for synchronous sessions.
+int64_t
+ep_session_get_dropped_event_count (EventPipeSession *session);
+
 ep_rt_wait_event_handle_t *
 ep_session_get_wait_event (EventPipeSession *session);
 
@@ -26,6 +26,7 @@
 #include "ep-stack-contents.c"
 #include "ep-stream.c"
 #include "ep-thread.c"
+#include "ep-user-events.c"
 #endif
 
 #endif /* ENABLE_PERFTRACING */
@@ -21,6 +21,12 @@ struct _EventPipeStackContents {
 #else
 struct _EventPipeStackContents_Internal {
 #endif
+	// The next available slot in stack_frames.
+	// Needs to go before the frame array: when an instance is written into the
+	// buffer manager only the captured frames are reserved and the tail of
+	// stack_frames is truncated.
+	uint32_t next_available_frame;
+
 	// Array of IP values from a stack crawl.
 	// Top of stack is at index 0.
 	uintptr_t stack_frames [EP_MAX_STACK_DEPTH];
@@ -29,13 +35,6 @@ struct _EventPipeStackContents_Internal {
 	// Used for debug-only stack printing.
 	ep_rt_method_desc_t *methods [EP_MAX_STACK_DEPTH];
 #endif
-
-	// TODO: Look at optimizing this when writing into buffer manager.
-	// Only write up to next available frame to better utilize memory.
-	// Even events not requesting a stack will still waste space in buffer manager.
-	// Needs to go first since it dictates size of struct.
-	// The next available slot in stack_frames.
-	uint32_t next_available_frame;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_STACK_CONTENTS_GETTER_SETTER)
@@ -224,6 +224,16 @@ ep_fast_serializer_write_buffer (
 	fast_serializer->write_error_encountered = ((buffer_len != bytes_written) || !result);
 }
 
+void
+ep_fast_serializer_flush (FastSerializer *fast_serializer)
+{
+	EP_ASSERT (fast_serializer != NULL);
+	ep_return_void_if_nok (!fast_serializer->write_error_encountered);
+
+	if (!ep_stream_writer_flush_vcall (fast_serializer->stream_writer))
+		fast_serializer->write_error_encountered = true;
+}
+
 void
 ep_fast_serializer_write_object (
 	FastSerializer *fast_serializer,
@@ -358,9 +368,18 @@ file_stream_writer_write_func (
 		bytes_written);
 }
 
+static
+bool
+file_stream_writer_flush_func (void *stream)
+{
+	// File writes are unbuffered at this layer; nothing pending to drain.
+	return true;
+}
+
 static StreamWriterVtable file_stream_writer_vtable = {
 	file_stream_writer_free_func,
-	file_stream_writer_write_func };
+	file_stream_writer_write_func,
+	file_stream_writer_flush_func };
 
 FileStreamWriter *
 ep_file_stream_writer_alloc (const ep_char8_t *output_file_path)
@@ -546,9 +565,19 @@ ipc_stream_writer_write_func (
 		bytes_written);
 }
 
+static
+bool
+ipc_stream_writer_flush_func (void *stream)
+{
+	EP_ASSERT (stream != NULL);
+
+	return ep_ipc_stream_writer_flush ((IpcStreamWriter *)stream);
+}
+
 static StreamWriterVtable ipc_stream_writer_vtable = {
 	ipc_stream_writer_free_func,
-	ipc_stream_writer_write_func };
+	ipc_stream_writer_write_func,
+	ipc_stream_writer_flush_func };
 
 IpcStreamWriter *
 ep_ipc_stream_writer_alloc (
@@ -564,6 +593,7 @@ ep_ipc_stream_writer_alloc (
 
 	//Ownership transfered.
 	instance->ipc_stream = stream;
+	instance->write_buffer_used = 0;
 
 ep_on_exit:
 	return instance;
@@ -579,6 +609,7 @@ ep_ipc_stream_writer_free (IpcStreamWriter *ipc_stream_writer)
 {
 	ep_return_void_if_nok (ipc_stream_writer != NULL);
 
+	ep_ipc_stream_writer_flush (ipc_stream_writer);
 	ep_ipc_stream_free_vcall (ipc_stream_writer->ipc_stream);
 	ep_stream_writer_fini (&ipc_stream_writer->stream_writer);
 	ep_rt_object_free (ipc_stream_writer);
@@ -601,7 +632,20 @@ ep_ipc_stream_writer_write (
 	bool result = false;
 
 	ep_raise_error_if_nok (ep_ipc_stream_writer_get_ipc_stream (ipc_stream_writer) != NULL);
-	result = ep_ipc_stream_write_vcall (ep_ipc_stream_writer_get_ipc_stream (ipc_stream_writer), buffer, bytes_to_write, bytes_written, EP_INFINITE_WAIT);
+
+	if (bytes_to_write >= EP_IPC_STREAM_WRITER_BUFFER_SIZE) {
+		// Too large to coalesce; drain anything pending (to keep the byte
+		// stream ordered) and pass the buffer straight to the transport.
+		ep_raise_error_if_nok (ep_ipc_stream_writer_flush (ipc_stream_writer));
+		result = ep_ipc_stream_write_vcall (ep_ipc_stream_writer_get_ipc_stream (ipc_stream_writer), buffer, bytes_to_write, bytes_written, EP_INFINITE_WAIT);
+	} else {
+		if (ipc_stream_writer->write_buffer_used + bytes_to_write > EP_IPC_STREAM_WRITER_BUFFER_SIZE)
+			ep_raise_error_if_nok (ep_ipc_stream_writer_flush (ipc_stream_writer));
+		memcpy (ipc_stream_writer->write_buffer + ipc_stream_writer->write_buffer_used, buffer, bytes_to_write);
+		ipc_stream_writer->write_buffer_used += bytes_to_write;
+		*bytes_written = bytes_to_write;
+		result = true;
+	}
 
 ep_on_exit:
 	return result;
@@ -611,6 +655,30 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+bool
+ep_ipc_stream_writer_flush (IpcStreamWriter *ipc_stream_writer)
+{
+	EP_ASSERT (ipc_stream_writer != NULL);
+
+	ep_return_false_if_nok (ep_ipc_stream_writer_get_ipc_stream (ipc_stream_writer) != NULL);
+
+	bool result = true;
+
+	if (ipc_stream_writer->write_buffer_used != 0) {
+		uint32_t bytes_written = 0;
+		result = ep_ipc_stream_write_vcall (
+			ep_ipc_stream_writer_get_ipc_stream (ipc_stream_writer),
+			ipc_stream_writer->write_buffer,
+			ipc_stream_writer->write_buffer_used,
+			&bytes_written,
+			EP_INFINITE_WAIT);
+		result = result && (bytes_written == ipc_stream_writer->write_buffer_used);
+		ipc_stream_writer->write_buffer_used = 0;
+	}
+
+	return result;
+}
+
 /*
  * StreamWriter.
  */
@@ -676,6 +744,18 @@ ep_stream_writer_write (
 		bytes_written);
 }
 
+bool
+ep_stream_writer_flush_vcall (StreamWriter *stream_writer)
+{
+	EP_ASSERT (stream_writer != NULL);
+	EP_ASSERT (stream_writer->vtable != NULL);
+
+	StreamWriterVtable *vtable = stream_writer->vtable;
+
+	EP_ASSERT (vtable->flush_func != NULL);
+	return vtable->flush_func (stream_writer);
+}
+
 #endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
 #endif /* ENABLE_PERFTRACING */
 
@@ -40,10 +40,12 @@ typedef enum
 
 typedef void (*StreamWriterFreeFunc)(void *stream);
 typedef bool (*StreamWriterWriteFunc)(void *stream, const uint8_t *buffer, const uint32_t bytes_to_write, uint32_t *bytes_written);
+typedef bool (*StreamWriterFlushFunc)(void *stream);
 
 struct _StreamWriterVtable {
 	StreamWriterFreeFunc free_func;
 	StreamWriterWriteFunc write_func;
+	StreamWriterFlushFunc flush_func;
 };
 
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_STREAM_GETTER_SETTER)
@@ -85,6 +87,9 @@ ep_stream_writer_write_vcall (
 	const uint32_t bytes_to_write,
 	uint32_t *bytes_written);
 
+bool
+ep_stream_writer_flush_vcall (StreamWriter *stream_writer);
+
 /*
  * FastSerializableObject.
  */
@@ -186,6 +191,9 @@ ep_fast_serializer_write_buffer (
 	const uint8_t *buffer,
 	uint32_t buffer_len);
 
+void
+ep_fast_serializer_flush (FastSerializer *fast_serializer);
+
 void
 ep_fast_serializer_write_object (
 	FastSerializer *fast_serializer,
@@ -285,6 +293,11 @@ ep_file_stream_writer_write (
  * IpcStreamWriter.
  */
 
+// The serializer issues many small writes per serialized object (tags,
+// lengths, payloads). Coalescing them here turns a batch of transport
+// syscalls into one per buffer's worth of data for same-host consumers.
+#define EP_IPC_STREAM_WRITER_BUFFER_SIZE (32 * 1024)
+
 #if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_STREAM_GETTER_SETTER)
 struct _IpcStreamWriter {
 #else
@@ -292,6 +305,10 @@ struct _IpcStreamWriter_Internal {
 #endif
 	StreamWriter stream_writer;
 	IpcStream *ipc_stream;
+	// Number of pending bytes in write_buffer.
+	uint32_t write_buffer_used;
+	// Coalescing buffer; drained by ep_ipc_stream_writer_flush.
+	uint8_t write_buffer [EP_IPC_STREAM_WRITER_BUFFER_SIZE];
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_STREAM_GETTER_SETTER)
@@ -318,5 +335,8 @@ ep_ipc_stream_writer_write (
 	uint32_t bytes_to_write,
 	uint32_t *bytes_written);
 
+bool
+ep_ipc_stream_writer_flush (IpcStreamWriter *ipc_stream_writer);
+
 #endif /* ENABLE_PERFTRACING */
 #endif /* __EVENTPIPE_STREAM_H__ */
@@ -25,6 +25,7 @@ typedef struct _EventPipeEventPayload EventPipeEventPayload;
 typedef struct _EventPipeEventSource EventPipeEventSource;
 typedef struct _EventPipeFile EventPipeFile;
 typedef struct _EventPipeJsonFile EventPipeJsonFile;
+typedef struct _EventPipeUserEvents EventPipeUserEvents;
 typedef struct _EventPipeMetadataBlock EventPipeMetadataBlock;
 typedef struct _EventPipeParameterDesc EventPipeParameterDesc;
 typedef struct _EventPipeProvider EventPipeProvider;
@@ -146,7 +147,8 @@ typedef enum {
 	EP_SESSION_TYPE_LISTENER,
 	EP_SESSION_TYPE_IPCSTREAM,
 	EP_SESSION_TYPE_SYNCHRONOUS,
-	EP_SESSION_TYPE_FILESTREAM
+	EP_SESSION_TYPE_FILESTREAM,
+	EP_SESSION_TYPE_USEREVENTS
 } EventPipeSessionType ;
 
 typedef enum {
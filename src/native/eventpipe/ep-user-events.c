@@ -0,0 +1,277 @@
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#if !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES)
+
+#define EP_IMPL_USER_EVENTS_GETTER_SETTER
+#include "ep-user-events.h"
+#include "ep-event.h"
+#include "ep-event-payload.h"
+#include "ep-provider.h"
+#include "ep-rt.h"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#endif
+
+#ifdef __linux__
+
+#define EP_USER_EVENTS_DATA_FILE "/sys/kernel/tracing/user_events_data"
+
+// Maximum length of a registration command:
+// "dotnet_<provider> u16 event_id; u16 event_version; __rel_loc u8[] payload".
+#define EP_USER_EVENTS_MAX_COMMAND_LEN 512
+
+// Registration ABI from <linux/user_events.h> (kernel 6.4+), declared locally
+// so builds against older kernel headers still compile; the ioctl simply
+// fails with ENOTTY/ENOENT on kernels without the facility.
+typedef struct ep_user_reg {
+	uint32_t size;
+	uint8_t enable_bit;
+	uint8_t enable_size;
+	uint16_t flags;
+	uint64_t enable_addr;
+	uint64_t name_args;
+	uint32_t write_index;
+} ep_user_reg_t;
+
+typedef struct ep_user_unreg {
+	uint32_t size;
+	uint8_t disable_bit;
+	uint8_t __reserved;
+	uint16_t __reserved2;
+	uint64_t disable_addr;
+} ep_user_unreg_t;
+
+#define EP_DIAG_IOCSREG _IOWR ('*', 0, ep_user_reg_t)
+#define EP_DIAG_IOCSUNREG _IOW ('*', 2, ep_user_unreg_t)
+
+// Fixed portion of the tracepoint record; the payload bytes follow
+// immediately, referenced by the __rel_loc field.
+typedef struct ep_user_events_header {
+	uint16_t event_id;
+	uint16_t event_version;
+	uint32_t payload_rel_loc;
+} ep_user_events_header_t;
+
+#endif /* __linux__ */
+
+/*
+ * Forward declares of all static functions.
+ */
+
+#ifdef __linux__
+static
+EventPipeUserEventsTracepoint *
+user_events_get_tracepoint (
+	EventPipeUserEvents *user_events,
+	const EventPipeProvider *provider);
+#endif
+
+/*
+ * EventPipeUserEvents.
+ */
+
+#ifdef __linux__
+
+// Look up the tracepoint registered for provider, registering it on first
+// use. Lookup is lock free; registration takes the registration lock.
+static
+EventPipeUserEventsTracepoint *
+user_events_get_tracepoint (
+	EventPipeUserEvents *user_events,
+	const EventPipeProvider *provider)
+{
+	EP_ASSERT (user_events != NULL);
+	EP_ASSERT (provider != NULL);
+
+	uint32_t count = ep_rt_volatile_load_uint32_t (&user_events->tracepoint_count);
+	for (uint32_t i = 0; i < count; ++i) {
+		if (user_events->tracepoints [i].provider == provider)
+			return &user_events->tracepoints [i];
+	}
+
+	EventPipeUserEventsTracepoint *tracepoint = NULL;
+
+	ep_rt_spin_lock_aquire (&user_events->registration_lock);
+
+	// Re-check under the lock; another thread may have registered it.
+	count = ep_rt_volatile_load_uint32_t (&user_events->tracepoint_count);
+	for (uint32_t i = 0; i < count; ++i) {
+		if (user_events->tracepoints [i].provider == provider) {
+			tracepoint = &user_events->tracepoints [i];
+			break;
+		}
+	}
+
+	if (tracepoint == NULL && count < EP_USER_EVENTS_MAX_TRACEPOINTS) {
+		// Tracepoint names accept [A-Za-z0-9_]; map everything else
+		// (dots in provider names, most commonly) to '_'.
+		char command [EP_USER_EVENTS_MAX_COMMAND_LEN];
+		int32_t len = ep_rt_utf8_string_snprintf (command, EP_ARRAY_SIZE (command), "dotnet_%s", ep_provider_get_provider_name (provider));
+		if (len > 0 && len < (int32_t)EP_ARRAY_SIZE (command)) {
+			for (int32_t i = 0; i < len; ++i) {
+				char c = command [i];
+				if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_'))
+					command [i] = '_';
+			}
+
+			len = ep_rt_utf8_string_snprintf (command + len, EP_ARRAY_SIZE (command) - len, " u16 event_id; u16 event_version; __rel_loc u8[] payload");
+			if (len > 0) {
+				EventPipeUserEventsTracepoint *candidate = &user_events->tracepoints [count];
+
+				ep_user_reg_t reg;
+				memset (&reg, 0, sizeof (reg));
+				reg.size = sizeof (reg);
+				reg.enable_bit = 0;
+				reg.enable_size = sizeof (uint32_t);
+				reg.enable_addr = (uint64_t)(uintptr_t)&candidate->enabled;
+				reg.name_args = (uint64_t)(uintptr_t)command;
+
+				if (ioctl (user_events->data_fd, EP_DIAG_IOCSREG, &reg) >= 0) {
+					candidate->write_index = reg.write_index;
+					candidate->provider = provider;
+					// Publish the entry before growing the count so the
+					// lock-free scan never observes a partial entry.
+					ep_rt_volatile_store_uint32_t (&user_events->tracepoint_count, count + 1);
+					tracepoint = candidate;
+				}
+			}
+		}
+	}
+
+	ep_rt_spin_lock_release (&user_events->registration_lock);
+
+	return tracepoint;
+}
+
+EventPipeUserEvents *
+ep_user_events_alloc (void)
+{
+	EventPipeUserEvents *instance = ep_rt_object_alloc (EventPipeUserEvents);
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->data_fd = open (EP_USER_EVENTS_DATA_FILE, O_RDWR);
+	ep_raise_error_if_nok (instance->data_fd != -1);
+
+	ep_rt_spin_lock_alloc (&instance->registration_lock);
+	ep_raise_error_if_nok (ep_rt_spin_lock_is_valid (&instance->registration_lock));
+
+	instance->tracepoint_count = 0;
+
+ep_on_exit:
+	return instance;
+
+ep_on_error:
+	ep_user_events_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+void
+ep_user_events_free (EventPipeUserEvents *user_events)
+{
+	ep_return_void_if_nok (user_events != NULL);
+
+	if (user_events->data_fd != -1) {
+		uint32_t count = ep_rt_volatile_load_uint32_t (&user_events->tracepoint_count);
+		for (uint32_t i = 0; i < count; ++i) {
+			ep_user_unreg_t unreg;
+			memset (&unreg, 0, sizeof (unreg));
+			unreg.size = sizeof (unreg);
+			unreg.disable_bit = 0;
+			unreg.disable_addr = (uint64_t)(uintptr_t)&user_events->tracepoints [i].enabled;
+			ioctl (user_events->data_fd, EP_DIAG_IOCSUNREG, &unreg);
+		}
+		close (user_events->data_fd);
+		user_events->data_fd = -1;
+	}
+
+	if (ep_rt_spin_lock_is_valid (&user_events->registration_lock))
+		ep_rt_spin_lock_free (&user_events->registration_lock);
+
+	ep_rt_object_free (user_events);
+}
+
+bool
+ep_user_events_write_event (
+	EventPipeUserEvents *user_events,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload)
+{
+	EP_ASSERT (user_events != NULL);
+	EP_ASSERT (ep_event != NULL);
+	EP_ASSERT (payload != NULL);
+
+	ep_return_false_if_nok (user_events->data_fd != -1);
+
+	EventPipeUserEventsTracepoint *tracepoint = user_events_get_tracepoint (user_events, ep_event_get_provider (ep_event));
+	ep_return_false_if_nok (tracepoint != NULL);
+
+	// The kernel sets the enable bit while any consumer is attached; an
+	// unobserved event costs just this load.
+	if ((ep_rt_volatile_load_uint32_t_without_barrier (&tracepoint->enabled) & 1) == 0)
+		return true;
+
+	uint32_t payload_size = ep_event_payload_get_size (payload);
+
+	ep_user_events_header_t header;
+	header.event_id = (uint16_t)ep_event_get_event_id (ep_event);
+	header.event_version = (uint16_t)ep_event_get_event_version (ep_event);
+	// __rel_loc: size in the upper 16 bits, offset relative to the end of
+	// this field in the lower 16. The payload follows the header directly.
+	header.payload_rel_loc = ((payload_size & 0xFFFF) << 16) | 0;
+
+	struct iovec io [3];
+	io [0].iov_base = &tracepoint->write_index;
+	io [0].iov_len = sizeof (tracepoint->write_index);
+	io [1].iov_base = &header;
+	io [1].iov_len = sizeof (header);
+	io [2].iov_base = (void *)ep_event_payload_get_flat_data (payload);
+	io [2].iov_len = payload_size;
+
+	ssize_t result;
+	do {
+		result = writev (user_events->data_fd, io, (payload_size != 0) ? 3 : 2);
+	} while (result == -1 && errno == EINTR);
+
+	return result != -1;
+}
+
+#else /* __linux__ */
+
+EventPipeUserEvents *
+ep_user_events_alloc (void)
+{
+	// user_events is a Linux kernel facility; other hosts have no back end.
+	return NULL;
+}
+
+void
+ep_user_events_free (EventPipeUserEvents *user_events)
+{
+	EP_ASSERT (user_events == NULL);
+}
+
+bool
+ep_user_events_write_event (
+	EventPipeUserEvents *user_events,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload)
+{
+	return false;
+}
+
+#endif /* __linux__ */
+
+#endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
+#endif /* ENABLE_PERFTRACING */
+
+#ifndef EP_INCLUDE_SOURCE_FILES
+extern const char quiet_linker_empty_file_warning_eventpipe_user_events;
+const char quiet_linker_empty_file_warning_eventpipe_user_events = 0;
+#endif
@@ -0,0 +1,84 @@
+#ifndef __EVENTPIPE_USER_EVENTS_H__
+#define __EVENTPIPE_USER_EVENTS_H__
+
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#include "ep-types.h"
+#include "ep-rt.h"
+
+#undef EP_IMPL_GETTER_SETTER
+#ifdef EP_IMPL_USER_EVENTS_GETTER_SETTER
+#define EP_IMPL_GETTER_SETTER
+#endif
+#include "ep-getter-setter.h"
+
+/*
+ * EventPipeUserEvents.
+ *
+ * Session back end that forwards events to the Linux user_events facility
+ * (/sys/kernel/tracing/user_events_data) so in-kernel consumers such as eBPF
+ * programs, ftrace and perf can attach to runtime events without a nettrace
+ * file or IPC stream. One tracepoint is registered per provider on first use,
+ * named "dotnet_" plus the sanitized provider name, with the stable layout:
+ *
+ *   u16 event_id; u16 event_version; __rel_loc u8[] payload
+ *
+ * The payload bytes are the event's flat payload, unchanged from what a
+ * nettrace session records for the same event; timestamps are assigned by the
+ * kernel at write time. Writes are skipped entirely while no consumer has the
+ * tracepoint enabled, so an idle session costs one predicated load per event.
+ * On kernels without user_events (or on non-Linux hosts), allocation fails
+ * and session creation reports an error, like a failed file open does for
+ * file sessions.
+ */
+
+// Maximum number of per-provider tracepoints a single session registers.
+#define EP_USER_EVENTS_MAX_TRACEPOINTS 16
+
+typedef struct _EventPipeUserEventsTracepoint {
+	// Provider this tracepoint was registered for. Written once under the
+	// registration lock, then published with a store barrier for lock-free
+	// lookup on the write path.
+	const EventPipeProvider *provider;
+	// Write index assigned by the kernel at registration time.
+	uint32_t write_index;
+	// Set by the kernel while at least one consumer has the tracepoint
+	// enabled; polled before writing.
+	volatile uint32_t enabled;
+} EventPipeUserEventsTracepoint;
+
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_USER_EVENTS_GETTER_SETTER)
+struct _EventPipeUserEvents {
+#else
+struct _EventPipeUserEvents_Internal {
+#endif
+	// File descriptor for user_events_data; -1 when unavailable.
+	int data_fd;
+	// Protects registration of new tracepoints.
+	ep_rt_spin_lock_handle_t registration_lock;
+	// Published count of valid entries in tracepoints.
+	volatile uint32_t tracepoint_count;
+	EventPipeUserEventsTracepoint tracepoints [EP_USER_EVENTS_MAX_TRACEPOINTS];
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_USER_EVENTS_GETTER_SETTER)
+struct _EventPipeUserEvents {
+	uint8_t _internal [sizeof (struct _EventPipeUserEvents_Internal)];
+};
+#endif
+
+EventPipeUserEvents *
+ep_user_events_alloc (void);
+
+void
+ep_user_events_free (EventPipeUserEvents *user_events);
+
+bool
+ep_user_events_write_event (
+	EventPipeUserEvents *user_events,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload);
+
+#endif /* ENABLE_PERFTRACING */
+#endif /* __EVENTPIPE_USER_EVENTS_H__ */